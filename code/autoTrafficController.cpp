@@ -13,49 +13,66 @@
  *      04DEC2021  R-12-04: Re-write following TrafficController
  *                          class update.
  *      07DEC2021  R-12-07: Debugging and code cleanup
+ *      17OCT2026  R-10-17: Split update into per pod hooks
+ *      17OCT2026  R-10-17: Update pass works on PodStore arrays
+ *      17OCT2026  R-10-17: Lane lookups by node index
+ *      17OCT2026  R-10-17: Allowed lanes checked by bitmask
+ *      17OCT2026  R-10-17: Lane queues held in ring buffers
+ *      17OCT2026  R-10-17: Queue membership checked by pod pointer
+ *      17OCT2026  R-10-17: Per phase steps run over phase buckets
+ *      17OCT2026  R-10-17: Kinematics in fixed point
+ *      17OCT2026  R-10-17: Earliest entry found through per lane reservation trees
+ *      17OCT2026  R-10-17: Optional space-time tile reservations
+ *      17OCT2026  R-10-17: Earliest entry found by scanning a time slot bitmap
+ *      17OCT2026  R-10-17: Optional look-ahead ordering of the pods admitted in a tick
+ *      17OCT2026  R-10-17: Optional platoons of pods following each other on a lane
+ *      17OCT2026  R-10-17: Every ordering of the admitted pods tried, ordering excludes tiles
+ *      17OCT2026  R-10-17: Reservations recorded in per lane reservation trees
+ *      17OCT2026  R-10-17: First tick held kept in the pod store instead of reservation trees
+ *      17OCT2026  R-10-17: Orderings tried per tick capped by the ordering limit
+ *      17OCT2026  R-10-17: Platoons and tile reservations rejected together
+ *      17OCT2026  R-10-17: Lane bitmap left alone with tile reservations
  * 
  **/
 
 #include "autoTrafficController.h"
 
+// World queue ordering, a new entry goes after the pods entering at the same time
+static bool enterBefore(unsigned long int entry, Pod* thePod)
+{
+    return entry < thePod->getEntry();
+}
+
 /**
  * setPodEntry
  * Inputs:
  *      Pod* - Pointer to the pod being scheduled
  *      unsigned long int - The desired entry time of the pod
+ *      unsigned long int - First tick held if taken over from an earlier reservation, the entry by default
  * Outputs: None
  * Description:
- *          Sets the entry time of the pod and adjusts
- *          the worldQueue so that it remains ordered in
- *          terms of entry times.
+ *          Sets the entry time of the pod, inserts it in the worldQueue
+ *          so that it remains ordered in terms of entry times and
+ *          reserves the ticks of its crossing on its lane, from the
+ *          first tick given on, unless it reserved tiles instead.
  **/
-void AutoTrafficController::setPodEntry(Pod* thePod, unsigned long int desiredEntry)
+void AutoTrafficController::setPodEntry(Pod* thePod, unsigned long int desiredEntry, unsigned long int start)
 {
     if (DEBUG) {std::cout << "Entered setPodEntry\n";}
 
     // Set the pod's entry time
     thePod->setTarget(desiredEntry, globalTime);
-    
-    // Update the worldQueue to maintain ascending entry times
-    if (worldQueue.empty())
-    {
-        // First pod in world queue
-        worldQueue.push_back(thePod);
-    }
-    else
+
+    // Binary search for the spot that keeps ascending entry times
+    std::vector<Pod*>::iterator it = std::upper_bound(worldQueue.begin(), worldQueue.end(), desiredEntry, enterBefore);
+    worldQueue.insert(it, thePod);
+
+    // Tile reservations are kept in the tile grid alone, and their
+    // windows on one lane may overlap, so the lane bitmap is left alone
+    if (!tileReservations)
     {
-        // Iterate through world queue until correct spot is found, then insert
-        for (int i=0; i<worldQueue.size(); ++i)
-        {
-            if (desiredEntry < worldQueue[i]->getEntry())
-            {
-                std::vector<Pod*>::iterator it = worldQueue.begin() + i;
-                worldQueue.insert(it, thePod);
-                if (DEBUG) {std::cout << "Exited set pod entry\n";}
-                return;
-            }
-        }
-        worldQueue.push_back(thePod);
+        thePod->setHeld(start < desiredEntry ? start : desiredEntry);
+        occupancy.occupy(thePod->getLane()->getLaneIndex(), thePod->getEntry(), thePod->getExit());
     }
 
     if (DEBUG) {std::cout << "Exited setPodEntry\n";}
@@ -68,7 +85,11 @@ void AutoTrafficController::setPodEntry(Pod* thePod, unsigned long int desiredEn
  * Outputs: None
  * Description:
  *          Creates a pod for the vehicle and attempts to find the earliest
- *          timeslot at which the pod can enter the intersection without causing a collision
+ *          timeslot at which the pod can enter the intersection without causing a collision.
+ *          The entry is the first tick of the earliest run of ticks, as
+ *          long as the crossing, that no conflicting lane has reserved.
+ *          The bitmap is scanned a row of ticks at a time, so the search
+ *          does not depend on how many pods are scheduled.
  **/
 void AutoTrafficController::schedulePod(Vehicle* entryVehicle)
 {
@@ -78,191 +99,542 @@ void AutoTrafficController::schedulePod(Vehicle* entryVehicle)
     entryVehicle->setTrafficControl(true);
     
     // Create a pod
-    std::string lane_id = entryVehicle->getSource()->nodeID + "-" + entryVehicle->getDestination()->nodeID;
-    Lane* desiredLane = thisIntersection->getLane(lane_id);
-    std::string src_node_id = desiredLane->getSource()->nodeID;
-    Pod* entryPod = new Pod(entryVehicle, desiredLane, globalTime);
-
-    // Add to controlled pods
-    controlledPods.push_back(entryPod);
+    Lane* desiredLane = thisIntersection->getLane(entryVehicle->getSource(), entryVehicle->getDestination());
+    Pod* entryPod = controlledPods.create(entryVehicle, desiredLane, globalTime);
     
     // Add pod to lane queue
-    std::map<std::string, std::vector<Pod*>>::iterator it = laneQueues.find(src_node_id);
-    unsigned long int earliestEntryTime = it->second.empty() ? 0 : it->second.back()->getEntry() + 1;
+    LaneQueue& thisLaneQueue = laneQueues[desiredLane->getSource()->nodeIndex];
+    Pod* leader = thisLaneQueue.empty() ? NULL : thisLaneQueue.back();
+    unsigned long int earliestEntryTime = thisLaneQueue.empty() ? 0 : thisLaneQueue.back()->getEntry() + 1;
     if (entryPod->predictedEntry(globalTime) > earliestEntryTime)
     {
         earliestEntryTime = entryPod->predictedEntry(globalTime);
     }
-    it->second.push_back(entryPod);
+    thisLaneQueue.push(entryPod);
 
-    // Check if worldQueue is empty
-    if (worldQueue.empty())
+    if (platoons && joinPlatoon(entryPod, leader, earliestEntryTime))
     {
-        setPodEntry(entryPod, earliestEntryTime);
         if (DEBUG) {std::cout << "Exited schedulePod\n";}
         return;
     }
 
-    // Go through worldQueue and look for an open timeslot
-    unsigned long int bannedEntry = 0;
-    unsigned long int bannedExit = earliestEntryTime;
-    for (int i=0; i<worldQueue.size(); ++i)
+    if (orderedEntries)
     {
-        Pod* thisPod = worldQueue[i];
-        // Ignore pods that leave the intersection before we can possibly arrive
-        if (thisPod->getExit() < bannedExit)
-        {
-            continue;
-        }
-        // If sufficient time between ban and this pod
-        if (thisPod->getEntry() >= bannedExit + entryPod->getTimeInIntersection())
-        {
-            setPodEntry(entryPod, bannedExit);
-            if (DEBUG) {std::cout << "Exited schedulePod\n";}
-            return;
-        }
+        // Reserved together with the other pods of this tick
+        PendingEntry thisEntry;
+        thisEntry.pod = entryPod;
+        thisEntry.lane = desiredLane->getLaneIndex();
+        thisEntry.earliest = earliestEntryTime;
+        thisEntry.crossing = entryPod->getTimeInIntersection();
+        pendingEntries.push_back(thisEntry);
+        if (DEBUG) {std::cout << "Exited schedulePod\n";}
+        return;
+    }
 
-        // If pod is allowed
-        if (entryPod->getLane()->isAllowedLane(thisPod->getLane()->getLaneID()))
+    if (tileReservations)
+    {
+        // Probe the grid for the first entry at which every tile swept is free
+        std::vector<unsigned long long>& footprint = getFootprint(entryPod);
+        tileGrid.advance(globalTime);
+        earliestEntryTime = tileGrid.earliestFit(earliestEntryTime, footprint);
+        tileGrid.reserve(earliestEntryTime, footprint);
+    }
+    else
+    {
+        // Earliest run of the crossing's ticks free on every conflicting lane
+        occupancy.advance(globalTime);
+        earliestEntryTime = occupancy.earliestRun(conflictLanes[desiredLane->getLaneIndex()],
+                                                  earliestEntryTime, entryPod->getTimeInIntersection());
+    }
+
+    setPodEntry(entryPod, earliestEntryTime);
+    if (DEBUG) {std::cout << "Exited schedulePod\n";}
+}
+
+/**
+ * commitEntries
+ * Inputs: None
+ * Outputs: None
+ * Description:
+ *          Reserves the pods admitted this tick in the ordering with the
+ *          least total delay out of the orderings tried. Admission takes
+ *          at most one pod per source each tick, so N sources give up to
+ *          N! orderings. At most orderingLimit of them are tried, in
+ *          lexicographic order, so a tick costs at most that many
+ *          placements of the admitted pods. First come first served is
+ *          tried first and kept on ties, so it is what a tick falls back
+ *          to when no ordering tried beats it. The default limit covers
+ *          every ordering of up to 5 sources.
+ **/
+void AutoTrafficController::commitEntries()
+{
+    if (pendingEntries.empty())
+    {
+        return;
+    }
+    occupancy.advance(globalTime);
+
+    std::vector<unsigned int> order(pendingEntries.size());
+    for (unsigned int k=0; k<order.size(); ++k)
+    {
+        order[k] = k;
+    }
+    std::vector<unsigned int> bestOrder = order;
+    std::vector<unsigned long int> entries;
+    unsigned long int bestDelay = placeOrdering(order, entries);
+    unsigned long int tried = 1;
+    while (bestDelay > 0 && tried < orderingLimit && std::next_permutation(order.begin(), order.end()))
+    {
+        tried++;
+        unsigned long int delay = placeOrdering(order, entries);
+        if (delay < bestDelay)
         {
-            continue;
+            bestDelay = delay;
+            bestOrder = order;
         }
-        else
+    }
+
+    // Reserve in the best ordering
+    placeOrdering(bestOrder, entries);
+    for (unsigned int k=0; k<bestOrder.size(); ++k)
+    {
+        setPodEntry(pendingEntries[bestOrder[k]].pod, entries[k]);
+    }
+    pendingEntries.clear();
+}
+
+/**
+ * placeOrdering
+ * Inputs:
+ *      std::vector<unsigned int>& - Pending pods in the order they are reserved
+ *      std::vector<unsigned long int>& - Set to the entry of each pod in that order
+ * Outputs:
+ *      unsigned long int - Total delay of the pods past their earliest entry
+ * Description:
+ *          Gives each pod in turn the earliest entry that is free both in
+ *          the occupancy bitmap and of the pods placed before it. Only
+ *          reads the bitmap, so trying an ordering changes nothing.
+ **/
+unsigned long int AutoTrafficController::placeOrdering(std::vector<unsigned int>& order, std::vector<unsigned long int>& entries)
+{
+    unsigned long int delay = 0;
+    entries.resize(order.size());
+    for (unsigned int k=0; k<order.size(); ++k)
+    {
+        PendingEntry& thisEntry = pendingEntries[order[k]];
+        unsigned long long conflicts = conflictLanes[thisEntry.lane];
+        unsigned long int entry = thisEntry.earliest;
+        bool moved = true;
+        while (moved)
         {
-            // Check if current pod extends banned period
-            if (bannedEntry <= thisPod->getEntry() && thisPod->getEntry() <= bannedExit)
+            moved = false;
+            entry = occupancy.earliestRun(conflicts, entry, thisEntry.crossing);
+            for (unsigned int j=0; j<k; ++j)
             {
-                bannedExit = thisPod->getExit() > bannedExit ? thisPod->getExit() : bannedExit;
-                continue;
-            }
-            else
-            {
-                // Current pod's entry point is greater than bannedExit
-                // Check if sufficient space between bannedExit and current pod entry for our pod
-                if (thisPod->getEntry() - bannedExit >= entryPod->getTimeInIntersection())
+                PendingEntry& placed = pendingEntries[order[j]];
+                if ((conflicts >> placed.lane & 1) && entries[j] < entry + thisEntry.crossing
+                    && entries[j] + placed.crossing > entry)
                 {
-                    setPodEntry(entryPod, bannedExit);
-                    if (DEBUG) {std::cout << "Exited schedulePod\n";}
-                    return;
-                }
-                else
-                {
-                    bannedExit = thisPod->getExit() > bannedExit ? thisPod->getExit() : bannedExit;
-                    continue;
+                    entry = entries[j] + placed.crossing;
+                    moved = true;
                 }
             }
-        } 
+        }
+        entries[k] = entry;
+        delay += entry - thisEntry.earliest;
     }
+    return delay;
+}
 
-    // Went through worldQueue and didn't find any open slots
-    setPodEntry(entryPod, bannedExit);
-    if (DEBUG) {std::cout << "Exited schedulePod\n";}
+/**
+ * applySignals
+ * Inputs:
+ *      UpdateSignals& - Signals collected during the update
+ * Outputs: None
+ * Description:
+ *          Releases the reservations of pods leaving the world queue,
+ *          then pops the queues as signaled
+ **/
+void AutoTrafficController::applySignals(UpdateSignals& signals)
+{
+    if (signals.popWorld)
+    {
+        releaseReservation(worldQueue.front());
+    }
+    // Departed pods are swept from the world queue later
+    for (int i=0; i<signals.departed.size(); ++i)
+    {
+        releaseReservation(signals.departed[i]);
+    }
+    TrafficController::applySignals(signals);
 }
 
 /**
- * doUpdate
+ * resetState
  * Inputs: None
  * Outputs: None
  * Description:
- *          Loops through all controlled pods and updates their position
- *          Uses OpenMP to speed up the update process
+ *          Empties the occupancy bitmap and the tile grid
  **/
-void AutoTrafficController::doUpdate()
+void AutoTrafficController::resetState()
 {
-    if (DEBUG) {std::cout << "Entered doUpdate\n";}
+    pendingEntries.clear();
+    occupancy.clear();
+    tileGrid.clear();
+}
 
-    // Prepare post multithreading update flags
-    bool popWorld = false;
-    bool leaveControl = false;
-    std::vector<std::string> popLane;
+/**
+ * setTileReservations
+ * Inputs:
+ *      bool - Whether pods reserve tiles instead of lanes
+ * Outputs:
+ *      bool - False if ordered entries or platoons are on and nothing changed
+ * Description:
+ *          Chooses how pods reserve the intersection. Tiles cannot be
+ *          combined with ordered entries or platoons, which place pods
+ *          on the occupancy bitmap only.
+ **/
+bool AutoTrafficController::setTileReservations(bool tiles)
+{
+    if (tiles && (orderedEntries || platoons))
+    {
+        return false;
+    }
+    tileReservations = tiles;
+    return true;
+}
+
+/**
+ * setOrderedEntries
+ * Inputs:
+ *      bool - Whether the pods admitted in a tick are reserved in their best ordering
+ * Outputs:
+ *      bool - False if tile reservations are on and nothing changed
+ * Description:
+ *          Chooses between first come first served and reserving the
+ *          pods of a tick together. Not possible with tile reservations,
+ *          since orderings are placed on the occupancy bitmap.
+ **/
+bool AutoTrafficController::setOrderedEntries(bool ordered)
+{
+    if (ordered && tileReservations)
+    {
+        return false;
+    }
+    orderedEntries = ordered;
+    return true;
+}
+
+/**
+ * setPlatoons
+ * Inputs:
+ *      bool - Whether pods follow the pod ahead on their lane through the intersection
+ * Outputs:
+ *      bool - False if tile reservations are on and nothing changed
+ * Description:
+ *          Chooses whether pods may join the platoon of the pod ahead.
+ *          Not possible with tile reservations, since platoon windows
+ *          are checked and extended on the occupancy bitmap.
+ **/
+bool AutoTrafficController::setPlatoons(bool grouped)
+{
+    if (grouped && tileReservations)
+    {
+        return false;
+    }
+    platoons = grouped;
+    return true;
+}
+
+/**
+ * buildConflictLanes
+ * Inputs: None
+ * Outputs: None
+ * Description:
+ *          Masks, for every lane, the lanes it is not allowed to
+ *          share the intersection with
+ **/
+void AutoTrafficController::buildConflictLanes()
+{
+    unsigned int numLanes = thisIntersection->getNumLanes();
+    conflictLanes.assign(numLanes, 0);
+    for (unsigned int i=0; i<numLanes; ++i)
+    {
+        Lane* thisLane = thisIntersection->getLaneByIndex(i);
+        for (unsigned int j=0; j<numLanes; ++j)
+        {
+            if (!thisLane->isAllowedLane(thisIntersection->getLaneByIndex(j)))
+            {
+                conflictLanes[i] |= 1ULL << j;
+            }
+        }
+    }
+}
 
-    // Begin parallel computing for update
-    int i, N, tid;
-    N = controlledPods.size();
+/**
+ * getFootprint
+ * Inputs:
+ *      Pod* - Pointer to a pod being scheduled
+ * Outputs:
+ *      std::vector<unsigned long long>& - Tiles swept on each tick of the pod's crossing
+ * Description:
+ *          Splits the crossing of the pod's lane into one equal part
+ *          per tick in the intersection and asks the intersection for
+ *          the tiles of each. Worked out once per lane.
+ **/
+std::vector<unsigned long long>& AutoTrafficController::getFootprint(Pod* thePod)
+{
+    Lane* thisLane = thePod->getLane();
+    std::vector<unsigned long long>& footprint = footprints[thisLane->getLaneIndex()];
+    if (footprint.empty())
+    {
+        unsigned long int ticks = thePod->getTimeInIntersection() > 0 ? thePod->getTimeInIntersection() : 1;
+        for (unsigned long int k=0; k<ticks; ++k)
+        {
+            footprint.push_back(thisIntersection->getTileMask(thisLane, (double)k / ticks, (double)(k + 1) / ticks));
+        }
+    }
+    return footprint;
+}
 
-#pragma omp parallel shared(i, N) private(tid)
+/**
+ * releaseReservation
+ * Inputs:
+ *      Pod* - Pointer to a pod leaving the world queue
+ * Outputs: None
+ * Description:
+ *          Frees the ticks still to come from the first tick the pod
+ *          holds to its exit, if it still holds a reservation
+ **/
+void AutoTrafficController::releaseReservation(Pod* thePod)
+{
+    unsigned long int start = thePod->getHeld();
+    if (start == POD_NOT_HELD)
     {
-        tid = omp_get_thread_num();
+        return;
+    }
+    thePod->setHeld(POD_NOT_HELD);
+    start = start > globalTime ? start : globalTime;
+    occupancy.release(thePod->getLane()->getLaneIndex(), start, thePod->getExit());
+}
 
-#pragma omp for schedule(dynamic)
-        for (i=0; i<N; ++i)
+/**
+ * joinPlatoon
+ * Inputs:
+ *      Pod* - Pointer to the pod being scheduled
+ *      Pod* - Pointer to the pod ahead of it in its lane queue, NULL if none
+ *      unsigned long int - Earliest entry of the pod
+ * Outputs:
+ *      bool - True if the pod was scheduled behind the pod ahead
+ * Description:
+ *          Lets the pod enter at its earliest entry if the pod ahead is on
+ *          the same lane and still crossing by then. The window of the
+ *          platoon grows to the pod's exit if no conflicting lane, its
+ *          own included, is reserved in between. The pod then takes over
+ *          the reservation of the pod ahead, so the last pod of a platoon
+ *          frees what is left of the window.
+ **/
+bool AutoTrafficController::joinPlatoon(Pod* thePod, Pod* leader, unsigned long int earliest)
+{
+    if (leader == NULL || leader->getLane() != thePod->getLane() || leader->getHeld() == POD_NOT_HELD
+        || earliest >= leader->getExit())
+    {
+        return false;
+    }
+    unsigned long int exit = earliest + thePod->getTimeInIntersection();
+    if (exit > leader->getExit())
+    {
+        // Only the ticks past the window are not held by the platoon already
+        unsigned int lane = thePod->getLane()->getLaneIndex();
+        occupancy.advance(globalTime);
+        if (occupancy.earliestRun(conflictLanes[lane], leader->getExit(), exit - leader->getExit()) != leader->getExit())
         {
-            Pod* thisPod = controlledPods[i];
+            return false;
+        }
+    }
+    unsigned long int start = leader->getHeld();
+    leader->setHeld(POD_NOT_HELD);
+    setPodEntry(thePod, earliest, start);
+    return true;
+}
 
-            if (DEBUG) {std::cout << thisPod->getPodID() << " : " << thisPod->getLane()->getLaneID() << " : " << thisPod->getPosition() << std::endl;}
+/**
+ * stepPod
+ * Inputs:
+ *      unsigned int - Slot of the pod being updated
+ *      UpdateSignals& - Signals for the post update
+ * Outputs:
+ *      bool - True if the pod has left intersection control
+ * Description:
+ *          Updates the position of a single pod for one tick
+ *          with the step of its phase. Used by the event engine.
+ **/
+bool AutoTrafficController::stepPod(unsigned int slot, UpdateSignals& signals)
+{
+    if (DEBUG) {std::cout << controlledPods[slot]->getPodID() << " : " << controlledPods.getBounds(slot).lane->getLaneID() << " : " << controlledPods[slot]->getPosition() << std::endl;}
 
-            // Check if in slowed region
-            if (thisPod->getCountdown() > 0 && thisPod->getPosition() <= thisPod->getLane()->getBeginIntersection())
-            {
-                if (DEBUG) {std::cout << "Countdown: " << thisPod->getCountdown() << std::endl;}
-                thisPod->updatePosition(thisPod->getLane()->getSource()->speedLimit*3/4);
-            }
-            // Check if in go region before intersection
-            else if (thisPod->getPosition() <= thisPod->getLane()->getBeginIntersection())
+    switch (controlledPods.phase[slot])
+    {
+        case POD_APPROACHING:
+        case POD_WAITING:
+            approachPod(slot);
+            return false;
+        case POD_INSIDE:
+            crossPod(slot, signals);
+            return false;
+        case POD_EXITING:
+            exitPod(slot, signals);
+            return false;
+        default:
+            departPod(slot, signals);
+            return true;
+    }
+}
+
+/**
+ * stepBucket
+ * Inputs:
+ *      unsigned int - Phase of the bucket
+ *      UpdateSignals& - Signals for the post update
+ * Outputs: None
+ * Description:
+ *          Runs the step of the bucket's phase over all of its pods.
+ *          Called by every thread of the update, the pods of the
+ *          bucket are shared out among them.
+ **/
+void AutoTrafficController::stepBucket(unsigned int podPhase, UpdateSignals& signals)
+{
+    std::vector<unsigned int>& bucket = controlledPods.getBucket(podPhase);
+    int N = bucket.size();
+    switch (podPhase)
+    {
+        case POD_APPROACHING:
+        case POD_WAITING:
+#pragma omp for schedule(static) nowait
+            for (int k=0; k<N; ++k)
             {
-                if (DEBUG) {std::cout << "Normal...\n";}
-                thisPod->updatePosition(thisPod->getLane()->getSource()->speedLimit);
+                approachPod(bucket[k]);
             }
-            // Check if in intersection
-            else if (thisPod->getPosition() <= thisPod->getLane()->getEndIntersection())
+            break;
+        case POD_INSIDE:
+#pragma omp for schedule(static) nowait
+            for (int k=0; k<N; ++k)
             {
-                // Check if first in lane queue, if so, signal removal from lane queue
-                std::map<std::string, std::vector<Pod*>>::iterator laneIt = laneQueues.find(thisPod->getLane()->getSource()->nodeID);
-                if (!laneIt->second.empty() && laneIt->second.front()->getPodID() == thisPod->getPodID())
-                {
-                    popLane.push_back(thisPod->getLane()->getSource()->nodeID);
-                }
-                thisPod->updatePosition(thisPod->getLane()->getDestination()->speedLimit);
+                crossPod(bucket[k], signals);
             }
-            // Check if pod is beyond intersection but has not left yet
-            else if (thisPod->getPosition() <= thisPod->getLane()->getLaneLength())
+            break;
+        case POD_EXITING:
+#pragma omp for schedule(static) nowait
+            for (int k=0; k<N; ++k)
             {
-                // Check if first in world queue, if so, signal removal from world queue
-                if (!worldQueue.empty() && worldQueue[0]->getPodID() == thisPod->getPodID())
-                {
-                    popWorld = true;
-                }
-                thisPod->updatePosition(thisPod->getLane()->getDestination()->speedLimit);
+                exitPod(bucket[k], signals);
             }
-            // Pod has left intersection control
-            else
+            break;
+        default:
+#pragma omp for schedule(static) nowait
+            for (int k=0; k<N; ++k)
             {
-                // Get rid of this pod
-                controlledPods[i] = NULL;
-                thisPod->setExitStamp(globalTime);
-                delete thisPod;
-                leaveControl = true;
+                departPod(bucket[k], signals);
+                controlledPods[bucket[k]] = NULL;
             }
-        }
+            break;
     }
+}
 
-    // Signal received to pop the world queue
-    if (popWorld)
+/**
+ * approachPod
+ * Inputs:
+ *      unsigned int - Slot of a pod before the intersection
+ * Outputs: None
+ * Description:
+ *          Drives at three quarters of the speed limit while the
+ *          countdown runs, at the speed limit otherwise
+ **/
+void AutoTrafficController::approachPod(unsigned int slot)
+{
+    LaneBounds& bounds = controlledPods.getBounds(slot);
+    int speed = controlledPods.countdown[slot] > 0 ? PodStore::toFixed(bounds.approachSpeed*3/4) : bounds.approachFixed;
+    controlledPods.updatePosition(slot, speed);
+}
+
+/**
+ * crossPod
+ * Inputs:
+ *      unsigned int - Slot of a pod in the intersection
+ *      UpdateSignals& - Signals for the post update
+ * Outputs: None
+ * Description:
+ *          Signals removal from the lane queue if the pod is first in it
+ *          and drives at the exit speed limit
+ **/
+void AutoTrafficController::crossPod(unsigned int slot, UpdateSignals& signals)
+{
+    LaneBounds& bounds = controlledPods.getBounds(slot);
+    LaneQueue& thisLaneQueue = laneQueues[bounds.sourceIndex];
+    if (!thisLaneQueue.empty() && thisLaneQueue.front() == controlledPods[slot])
     {
-        worldQueue.erase(worldQueue.begin());
+#pragma omp critical
+        signals.popLane.push_back(bounds.sourceIndex);
     }
+    controlledPods.updatePosition(slot, bounds.exitFixed);
+}
 
-    // Signal received that a pod left control
-    if (leaveControl)
+/**
+ * exitPod
+ * Inputs:
+ *      unsigned int - Slot of a pod past the intersection
+ *      UpdateSignals& - Signals for the post update
+ * Outputs: None
+ * Description:
+ *          Signals removal from the world queue if the pod is first in it
+ *          and drives at the exit speed limit
+ **/
+void AutoTrafficController::exitPod(unsigned int slot, UpdateSignals& signals)
+{
+    if (!worldQueue.empty() && worldQueue[0] == controlledPods[slot])
     {
-        for (int i=0; i<controlledPods.size(); ++i)
-        {
-            if (controlledPods[i] == NULL)
-            {
-                controlledPods.erase(controlledPods.begin() + i);
-                i--;
-            }
-        }
+        signals.popWorld = true;
+    }
+    controlledPods.updatePosition(slot, controlledPods.getBounds(slot).exitFixed);
+}
+
+/**
+ * quietTicks
+ * Inputs:
+ *      Pod* - Pointer to the pod
+ *      int& - Set to the speed the pod holds meanwhile
+ * Outputs:
+ *      unsigned long int - Number of upcoming ticks where the pod only
+ *                          moves at a fixed speed without affecting queues
+ * Description:
+ *          Used by the event engine. Only the approach to the intersection
+ *          is quiet, pods in and past the intersection are stepped every tick.
+ **/
+unsigned long int AutoTrafficController::quietTicks(Pod* thePod, int& speed)
+{
+    double distance = thePod->getLane()->getBeginIntersection() - thePod->getPosition();
+    if (distance < 0)
+    {
+        return 0;
     }
 
-    // Signal received to pop a lane queue
-    if (!popLane.empty())
+    // Slowed region lasts until the countdown or the approach runs out
+    if (thePod->getCountdown() > 0)
     {
-        for (int i=0; i<popLane.size(); ++i)
+        speed = thePod->getLane()->getSource()->speedLimit*3/4;
+        unsigned long int ticks = thePod->getCountdown();
+        if (speed > 0 && (unsigned long int)(distance / speed) + 1 < ticks)
         {
-            laneQueues.find(popLane[i])->second.erase(laneQueues.find(popLane[i])->second.begin());
+            ticks = (unsigned long int)(distance / speed) + 1;
         }
+        return ticks;
     }
 
-    if (DEBUG) {std::cout << "Exited doUpdate\n";}
+    // Go region lasts until the intersection is reached
+    speed = thePod->getLane()->getSource()->speedLimit;
+    if (speed <= 0)
+    {
+        return ULONG_MAX;
+    }
+    return (unsigned long int)(distance / speed) + 1;
 }
\ No newline at end of file
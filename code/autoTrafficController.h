@@ -16,6 +16,20 @@
  *      04DEC2021  R-12-04: Re-write following TrafficController
  *                          class update.
  *      07DEC2021  R-12-07: Debugging and code cleanup
+ *      17OCT2026  R-10-17: Split update into per pod hooks
+ *      17OCT2026  R-10-17: Join controller threads before destruction
+ *      17OCT2026  R-10-17: Per pod update hook takes a store slot
+ *      17OCT2026  R-10-17: Per phase steps run over phase buckets
+ *      17OCT2026  R-10-17: Reservations indexed by lane in interval trees
+ *      17OCT2026  R-10-17: Optional space-time tile reservations
+ *      17OCT2026  R-10-17: Reservations held in a time slot bitmap by lane
+ *      17OCT2026  R-10-17: Optional look-ahead ordering of the pods admitted in a tick
+ *      17OCT2026  R-10-17: Optional platoons of pods following each other on a lane
+ *      17OCT2026  R-10-17: Ordering of admitted pods switched on instead of budgeted
+ *      17OCT2026  R-10-17: Reservations recorded by lane in reservation trees
+ *      17OCT2026  R-10-17: Reservation trees replaced by the first tick held in the pod store
+ *      17OCT2026  R-10-17: Orderings tried per tick capped
+ *      17OCT2026  R-10-17: Platoons exclude tiles
  * 
  **/
 
@@ -23,23 +37,110 @@
 #define AUTOTRAFFICCONTROLLER_H
 
 #include "trafficController.h"
+#include "laneOccupancy.h"
+#include "tileGrid.h"
+
+// Most orderings of the pods admitted in a tick tried, unless set
+#define ORDERING_LIMIT 120
+
+/**
+ * PendingEntry Struct
+ * Description:
+ *          Data structure for a pod admitted this tick whose entry is not set yet
+ * Contains:
+ *      Pod* pod - Pointer to the pod
+ *      unsigned int lane - Lane index of the pod's lane
+ *      unsigned long int earliest - Earliest entry allowed by its lane queue and position
+ *      unsigned long int crossing - Ticks the pod spends in the intersection
+ **/
+struct PendingEntry
+{
+    Pod* pod;
+    unsigned int lane;
+    unsigned long int earliest;
+    unsigned long int crossing;
+};
 
 /**
  * AutoTrafficController Class
  * Description:
- *          Class that simulates an autonomously scheduled traffic controller
+ *          Class that simulates an autonomously scheduled traffic controller.
+ *          Every pod in the world queue also holds the ticks of its
+ *          crossing in the occupancy bitmap of its lane, from the first
+ *          tick held recorded in its slot. An arrival looks for the
+ *          earliest run of ticks free on every lane it conflicts with by
+ *          scanning the bitmap, and a pod leaving frees what it holds.
+ *          With tile reservations on, a pod reserves only the tiles of
+ *          the box its path sweeps on each tick of its crossing instead,
+ *          so pods on conflicting lanes can share the box as long as they
+ *          are never on the same tile at the same time.
+ *          With ordered entries on, the pods admitted in one tick, at
+ *          most one per source, are held back and reserved together in
+ *          the order that delays them the least in total. Orderings are
+ *          tried up to a limit, first come first served first, and it is
+ *          kept on ties. Ordered entries and tile reservations exclude each other.
+ *          With platoons on, a pod that reaches the intersection while the
+ *          pod ahead of it on the same lane is still crossing follows it
+ *          in, and their reservations join into one window. Only the ticks
+ *          the window grows by are checked against the other lanes.
+ *          Platoons and tile reservations exclude each other.
  **/
 class AutoTrafficController: public TrafficController
 {
 public:
     // Constructors
     AutoTrafficController(Intersection* theIntersection, unsigned int tickSpeed)
-        :TrafficController(theIntersection, tickSpeed){}
+        :TrafficController(theIntersection, tickSpeed), occupancy(theIntersection->getNumLanes()),
+        footprints(theIntersection->getNumLanes()), tileReservations(false), orderedEntries(false), orderingLimit(ORDERING_LIMIT), platoons(false){buildConflictLanes();}
+
+    // Destructors (threads must be joined before derived members go away)
+    ~AutoTrafficController(){stopController(); joinController();}
 
     // Member Functions
-    void setPodEntry(Pod* thePod, unsigned long int desiredEntry);
+    void setPodEntry(Pod* thePod, unsigned long int desiredEntry, unsigned long int start = ULONG_MAX);
     void schedulePod(Vehicle* entryVehicle);
-    void doUpdate();
+    void applySignals(UpdateSignals& signals);
+    void resetState();
+    void commitEntries();
+    bool stepPod(unsigned int slot, UpdateSignals& signals);
+    void stepBucket(unsigned int podPhase, UpdateSignals& signals);
+    unsigned long int quietTicks(Pod* thePod, int& speed);
+    bool supportsEvents(){return true;}
+
+    // Setters (only while no pod is scheduled)
+    bool setTileReservations(bool tiles);
+    bool setOrderedEntries(bool ordered);
+    void setOrderingLimit(unsigned long int orderings){orderingLimit = orderings > 0 ? orderings : 1;}
+    bool setPlatoons(bool grouped);
+
+    // Getters
+    bool getTileReservations(){return tileReservations;}
+    bool getOrderedEntries(){return orderedEntries;}
+    unsigned long int getOrderingLimit(){return orderingLimit;}
+    bool getPlatoons(){return platoons;}
+
+private:
+    LaneOccupancy occupancy;                    // Ticks reserved by the world queue on every lane
+    std::vector<unsigned long long> conflictLanes;  // Bit j set if lane j must not share the intersection with the lane
+    TileGrid tileGrid;                          // Tiles reserved by tick, used with tile reservations
+    std::vector<std::vector<unsigned long long> > footprints;   // Tiles swept on each tick of a crossing by lane index
+    bool tileReservations;                      // Whether pods reserve tiles instead of lanes
+    bool orderedEntries;                        // Whether the pods admitted in a tick are reserved in their best ordering
+    unsigned long int orderingLimit;            // Most orderings tried per tick
+    std::vector<PendingEntry> pendingEntries;   // Pods admitted this tick, reserved by commitEntries
+    bool platoons;                              // Whether pods follow the pod ahead on their lane through the intersection
+
+    // Helper Functions
+    void buildConflictLanes();
+    std::vector<unsigned long long>& getFootprint(Pod* thePod);
+    void releaseReservation(Pod* thePod);
+    bool joinPlatoon(Pod* thePod, Pod* leader, unsigned long int earliest);
+    unsigned long int placeOrdering(std::vector<unsigned int>& order, std::vector<unsigned long int>& entries);
+
+    // Per Phase Steps
+    void approachPod(unsigned int slot);
+    void crossPod(unsigned int slot, UpdateSignals& signals);
+    void exitPod(unsigned int slot, UpdateSignals& signals);
 };
 
 #endif
\ No newline at end of file
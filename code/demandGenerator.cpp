@@ -0,0 +1,175 @@
+/**
+ * Demand Generator
+ * 
+ * Authors: Marcus Chan, Raymond Jia
+ * Class: ECE 4122 - Hurley
+ * Final Project - Autonomous Traffic Simulator
+ * 
+ * Description:
+ *      Function implementation for DemandGenerator class
+ * 
+ * Revision History:
+ *      17OCT2026  R-10-17: Document Created, initial coding
+ *      17OCT2026  R-10-17: Per approach counter-based random streams
+ *      17OCT2026  R-10-17: Nodes looked up by node index
+ *      17OCT2026  R-10-17: Vehicles numbered instead of named
+ *      17OCT2026  R-10-17: Settable limits of generated vehicles
+ * 
+ **/
+
+#include "demandGenerator.h"
+
+// Constructor
+DemandGenerator::DemandGenerator(Intersection* theIntersection, unsigned int seed, unsigned int replication)
+    :thisIntersection(theIntersection)
+    {
+        headwayType = HEADWAY_POISSON;
+        vehiclesGenerated = 0;
+        setVehicleLimits(10, 10, 1, 1 * DEFAULT_BRAKING);
+        arrivalRates.assign(theIntersection->getNumNodes(), 0);
+        nextArrivals.assign(theIntersection->getNumNodes(), -1);
+        for (int i=0; i<theIntersection->getNumNodes(); ++i)
+        {
+            headwayStreams.push_back(RngStream(seed, replication, RngStream::approachStream(i, STREAM_HEADWAY)));
+            destStreams.push_back(RngStream(seed, replication, RngStream::approachStream(i, STREAM_DESTINATION)));
+        }
+    }
+
+/**
+ * setArrivalRates
+ * Inputs:
+ *      double - Arrival rate in vehicles per tick
+ * Outputs: None
+ * Description:
+ *          Sets the same arrival rate on every approach
+ **/
+void DemandGenerator::setArrivalRates(double rate)
+{
+    for (int i=0; i<arrivalRates.size(); ++i)
+    {
+        arrivalRates[i] = rate;
+    }
+}
+
+/**
+ * setVehicleLimits
+ * Inputs:
+ *      double - Maximum speed
+ *      double - Maximum turning speed
+ *      double - Acceleration
+ *      double - Deceleration
+ * Outputs: None
+ * Description:
+ *          Sets the limits every vehicle generated from now on is built
+ *          with. They only bind on pods whose controller limits acceleration.
+ **/
+void DemandGenerator::setVehicleLimits(double mS, double mTS, double a, double d)
+{
+    maxSpeed = mS;
+    maxTurnSpeed = mTS;
+    acceleration = a;
+    deceleration = d;
+}
+
+/**
+ * start
+ * Inputs:
+ *      unsigned long int - Current time
+ * Outputs: None
+ * Description:
+ *          Draws the first arrival of every approach from the current time.
+ *          Approaches with no demand never see an arrival.
+ **/
+void DemandGenerator::start(unsigned long int currentTime)
+{
+    for (int i=0; i<arrivalRates.size(); ++i)
+    {
+        nextArrivals[i] = arrivalRates[i] > 0 ? currentTime + drawHeadway(i) : -1;
+    }
+}
+
+/**
+ * getNextArrival
+ * Inputs: None
+ * Outputs:
+ *      unsigned long int - Tick of the next arrival, ULONG_MAX if none
+ * Description:
+ *          Finds the earliest upcoming arrival over all approaches
+ **/
+unsigned long int DemandGenerator::getNextArrival()
+{
+    unsigned long int next = ULONG_MAX;
+    for (int i=0; i<nextArrivals.size(); ++i)
+    {
+        if (nextArrivals[i] >= 0 && nextArrivals[i] < next)
+        {
+            next = nextArrivals[i];
+        }
+    }
+    return next;
+}
+
+/**
+ * nextVehicle
+ * Inputs:
+ *      unsigned long int - Current time
+ * Outputs:
+ *      Vehicle* - Next vehicle arriving by the current time, NULL if none
+ * Description:
+ *          Creates the earliest vehicle due by the current time and draws
+ *          the next arrival of its approach. Call repeatedly until NULL to
+ *          get every arrival of a tick in order of arrival.
+ **/
+Vehicle* DemandGenerator::nextVehicle(unsigned long int currentTime)
+{
+    // Find the earliest arrival
+    int src = -1;
+    for (int i=0; i<nextArrivals.size(); ++i)
+    {
+        if (nextArrivals[i] >= 0 && (src == -1 || nextArrivals[i] < nextArrivals[src]))
+        {
+            src = i;
+        }
+    }
+    if (src == -1 || nextArrivals[src] >= currentTime + 1)
+    {
+        return NULL;
+    }
+
+    // Choose a destination other than the source
+    unsigned int numNodes = thisIntersection->getNumNodes();
+    unsigned int dest = (src + 1 + destStreams[src].below(numNodes - 1)) % numNodes;
+
+    // Create vehicle, allocate memory
+    Vehicle* newVehicle = new Vehicle(vehiclesGenerated, maxSpeed, maxTurnSpeed, acceleration, thisIntersection->getNode((unsigned int)src), thisIntersection->getNode(dest));
+    newVehicle->setDeceleration(deceleration);
+    vehiclesGenerated++;
+
+    // Draw the approach's next arrival
+    nextArrivals[src] += drawHeadway(src);
+    return newVehicle;
+}
+
+/**
+ * drawHeadway
+ * Inputs:
+ *      unsigned int - Approach (source node) index
+ * Outputs:
+ *      double - Ticks until the approach's next arrival
+ * Description:
+ *          Draws a headway with mean 1/rate from the chosen distribution
+ **/
+double DemandGenerator::drawHeadway(unsigned int node)
+{
+    double rate = arrivalRates[node];
+    switch (headwayType)
+    {
+        case HEADWAY_UNIFORM:
+            return headwayStreams[node].uniform() * 2 / rate;
+        case HEADWAY_FIXED:
+            return 1 / rate;
+        case HEADWAY_POISSON:
+        default:
+            return headwayStreams[node].exponential(rate);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,81 @@
+/**
+ * Demand Generator
+ * 
+ * Authors: Marcus Chan, Raymond Jia
+ * Class: ECE 4122 - Hurley
+ * Final Project - Autonomous Traffic Simulator
+ * 
+ * Description:
+ *      Generates vehicles arriving at each approach of an intersection on
+ *      simulated time. Each approach has its own arrival rate and arrivals
+ *      are spaced by headways drawn from a chosen distribution, so several
+ *      vehicles may arrive within the same tick.
+ * 
+ * Revision History:
+ *      17OCT2026  R-10-17: Document Created, initial coding
+ *      17OCT2026  R-10-17: Per approach counter-based random streams
+ *      17OCT2026  R-10-17: Settable limits of generated vehicles
+ * 
+ **/
+
+#ifndef DEMANDGENERATOR_H
+#define DEMANDGENERATOR_H
+
+#include <climits>
+
+#include "intersection.h"
+#include "vehicle.h"
+#include "rngStream.h"
+
+#define HEADWAY_POISSON 0
+#define HEADWAY_UNIFORM 1
+#define HEADWAY_FIXED   2
+
+/**
+ * DemandGenerator Class
+ * Description:
+ *          Class that creates vehicles arriving at an intersection.
+ *          Rates are in vehicles per tick for each approach (source node)
+ *          and take effect when start is called. Headways and destinations
+ *          of each approach come from their own streams, so an approach's
+ *          arrivals depend only on the seed, the replication and its rate.
+ **/
+class DemandGenerator
+{
+public:
+    // Constructors
+    DemandGenerator(Intersection* theIntersection, unsigned int seed, unsigned int replication = 0);
+
+    // Member Functions
+    void start(unsigned long int currentTime);
+    Vehicle* nextVehicle(unsigned long int currentTime);
+
+    // Setters
+    void setArrivalRate(unsigned int node, double rate){arrivalRates[node] = rate;}
+    void setArrivalRates(double rate);
+    void setHeadway(int distribution){headwayType = distribution;}
+    void setVehicleLimits(double mS, double mTS, double a, double d);
+
+    // Getters
+    double getArrivalRate(unsigned int node){return arrivalRates[node];}
+    int getHeadway(){return headwayType;}
+    unsigned long int getNextArrival();
+    unsigned long int getVehiclesGenerated(){return vehiclesGenerated;}
+
+private:
+    double drawHeadway(unsigned int node);
+
+    Intersection* thisIntersection;         // Pointer to Intersection vehicles arrive at
+    std::vector<double> arrivalRates;       // Vehicles per tick for each approach
+    std::vector<double> nextArrivals;       // Continuous time of the next arrival at each approach
+    int headwayType;                        // Headway distribution identifier
+    std::vector<RngStream> headwayStreams;  // Headway stream of each approach
+    std::vector<RngStream> destStreams;     // Destination stream of each approach
+    unsigned long int vehiclesGenerated;    // Number of vehicles created so far
+    double maxSpeed;                        // Maximum speed of generated vehicles
+    double maxTurnSpeed;                    // Maximum turning speed of generated vehicles
+    double acceleration;                    // Acceleration of generated vehicles
+    double deceleration;                    // Deceleration of generated vehicles
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,128 @@
+/**
+ * Entry Ring
+ * 
+ * Authors: Marcus Chan, Raymond Jia
+ * Class: ECE 4122 - Hurley
+ * Final Project - Autonomous Traffic Simulator
+ * 
+ * Description:
+ *      Function implementation for EntryRing class
+ * 
+ * Revision History:
+ *      17OCT2026  R-10-17: Document Created, initial coding
+ * 
+ **/
+
+#include "entryRing.h"
+
+// Constructor
+EntryRing::EntryRing(unsigned long int capacity)
+    {
+        unsigned long int size = 2;
+        while (size < capacity)
+        {
+            size <<= 1;
+        }
+        mask = size - 1;
+        slots = new EntrySlot[size];
+        for (unsigned long int i=0; i<size; ++i)
+        {
+            slots[i].sequence.store(i, std::memory_order_relaxed);
+            slots[i].vehicle = NULL;
+        }
+        enqueuePos.store(0, std::memory_order_relaxed);
+        dequeuePos = 0;
+    }
+
+// Destructor
+EntryRing::~EntryRing()
+{
+    delete[] slots;
+}
+
+/**
+ * push
+ * Inputs:
+ *      Vehicle* - Pointer to the vehicle joining the ring
+ * Outputs:
+ *      bool - False if the ring is full
+ * Description:
+ *          Claims the next position with a compare and swap, fills the
+ *          slot and then publishes it. Safe from any number of threads.
+ **/
+bool EntryRing::push(Vehicle* entryVehicle)
+{
+    unsigned long int pos = enqueuePos.load(std::memory_order_relaxed);
+    EntrySlot* slot;
+    while (true)
+    {
+        slot = &slots[pos & mask];
+        unsigned long int sequence = slot->sequence.load(std::memory_order_acquire);
+        long int diff = (long int)sequence - (long int)pos;
+        if (diff == 0)
+        {
+            // Slot is free for this position, try to claim it
+            if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            // Consumer has not freed the slot from the last lap yet
+            return false;
+        }
+        else
+        {
+            // Another producer claimed it first
+            pos = enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+    slot->vehicle = entryVehicle;
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+/**
+ * pop
+ * Inputs:
+ *      Vehicle*& - Set to the vehicle at the front of the ring
+ * Outputs:
+ *      bool - False if the ring is empty
+ * Description:
+ *          Takes the front vehicle and hands its slot to the next lap.
+ *          Only one thread at a time may pop.
+ **/
+bool EntryRing::pop(Vehicle*& entryVehicle)
+{
+    EntrySlot* slot = &slots[dequeuePos & mask];
+    if (slot->sequence.load(std::memory_order_acquire) != dequeuePos + 1)
+    {
+        return false;
+    }
+    entryVehicle = slot->vehicle;
+    slot->sequence.store(dequeuePos + mask + 1, std::memory_order_release);
+    dequeuePos++;
+    return true;
+}
+
+/**
+ * drain
+ * Inputs:
+ *      std::queue<Vehicle*>& - Queue the vehicles are moved to
+ * Outputs:
+ *      unsigned long int - Number of vehicles moved
+ * Description:
+ *          Moves every published vehicle to the queue in order
+ **/
+unsigned long int EntryRing::drain(std::queue<Vehicle*>& destination)
+{
+    unsigned long int count = 0;
+    Vehicle* entryVehicle;
+    while (pop(entryVehicle))
+    {
+        destination.push(entryVehicle);
+        count++;
+    }
+    return count;
+}
\ No newline at end of file
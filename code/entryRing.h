@@ -0,0 +1,72 @@
+/**
+ * Entry Ring
+ * 
+ * Authors: Marcus Chan, Raymond Jia
+ * Class: ECE 4122 - Hurley
+ * Final Project - Autonomous Traffic Simulator
+ * 
+ * Description:
+ *      Bounded lock-free queue of vehicles entering a traffic controller.
+ *      Any number of threads may push, one thread at a time may pop.
+ *      Every slot carries a sequence number telling producers and the
+ *      consumer whose turn it is, so neither side ever takes a lock.
+ * 
+ * Revision History:
+ *      17OCT2026  R-10-17: Document Created, initial coding
+ * 
+ **/
+
+#ifndef ENTRYRING_H
+#define ENTRYRING_H
+
+#include <atomic>
+#include <queue>
+
+#include "vehicle.h"
+
+/**
+ * EntrySlot Struct
+ * Description:
+ *          Data structure for one slot of the ring
+ * Contains:
+ *      std::atomic<unsigned long int> sequence - Position the slot is ready for
+ *      Vehicle* vehicle - Pointer to the queued vehicle
+ **/
+struct EntrySlot
+{
+    std::atomic<unsigned long int> sequence;
+    Vehicle* vehicle;
+};
+
+/**
+ * EntryRing Class
+ * Description:
+ *          Multi-producer single-consumer ring of vehicles.
+ *          Capacity is rounded up to a power of two.
+ **/
+class EntryRing
+{
+public:
+    // Constructors
+    EntryRing(unsigned long int capacity);
+
+    // Destructors
+    ~EntryRing();
+
+    // Member Functions
+    bool push(Vehicle* entryVehicle);
+    bool pop(Vehicle*& entryVehicle);
+    unsigned long int drain(std::queue<Vehicle*>& destination);
+
+    // Getters
+    unsigned long int getCapacity(){return mask + 1;}
+    bool empty(){return slots[dequeuePos & mask].sequence.load(std::memory_order_acquire) != dequeuePos + 1;}
+
+private:
+    EntrySlot* slots;                       // Array of slots
+    unsigned long int mask;                 // Capacity minus one
+    alignas(64) std::atomic<unsigned long int> enqueuePos;  // Next position claimed by a producer
+    alignas(64) unsigned long int dequeuePos;               // Next position read by the consumer
+};
+
+#endif
\ No newline at end of file
@@ -11,6 +11,9 @@
  * Revision History:
  *      30NOV2021  R-11-30: Document Created, initial coding
  *      07DEC2021  R-12-07: Debugging and code cleanup
+ *      17OCT2026  R-10-17: Nodes and lanes added with dense indices
+ *      17OCT2026  R-10-17: Allowed lane bitmasks built on construction
+ *      17OCT2026  R-10-17: Added tile geometry of the intersection box
  * 
  **/
 
@@ -24,11 +27,11 @@ Intersect4WSL::Intersect4WSL(unsigned int speedLimit)
         for (int i=0; i<4; ++i)
         {
             Node* nodePtr = new Node;
+            nodePtr->intersectionID = "4W-SL";
+            nodePtr->nodeID = std::to_string(i);
+            nodePtr->speedLimit = speedLimit;
             // Add node to node vector
-            intersectionNodes.push_back(nodePtr);
-            intersectionNodes[i]->intersectionID = "4W-SL";
-            intersectionNodes[i]->nodeID = std::to_string(i);
-            intersectionNodes[i]->speedLimit = speedLimit;
+            addNode(nodePtr);
         }
 
         // Iterate among nodes to create lanes
@@ -45,8 +48,8 @@ Intersect4WSL::Intersect4WSL(unsigned int speedLimit)
                 // Create and initialize new lane
                 Lane* thisLane = new Lane(intersectionNodes[i], intersectionNodes[j], DEFAULT_LANE_LENGTH, DEFAULT_INTERSECTION_START, DEFAULT_INTERSECTION_END);
                 std::string lane_id = std::to_string(i) + "-" + std::to_string(j);
-                // Add lane to lane vector
-                intersectionLanes.push_back(thisLane);
+                // Add lane to lane vector and lane table
+                addLane(thisLane);
 
                 // Set allowed concurrent lanes and lane type
                 switch (j-i)
@@ -96,4 +99,85 @@ Intersect4WSL::Intersect4WSL(unsigned int speedLimit)
                 }
             }
         }
-    }
\ No newline at end of file
+
+        // Compatibility of every lane pair as bitmasks
+        buildAllowedMasks();
+    }
+
+/**
+ * getTileMask
+ * Inputs:
+ *      Lane* - Pointer to a lane
+ *      double - Fraction of the crossing the part starts at
+ *      double - Fraction of the crossing the part ends at
+ * Outputs:
+ *      unsigned long long - Bit row * TILE_GRID + column set for every tile swept
+ * Description:
+ *          Samples the path over the part of the crossing and marks
+ *          every tile within a vehicle's clearance of a sample
+ **/
+unsigned long long Intersect4WSL::getTileMask(Lane* lane, double from, double to)
+{
+    double tileSize = 2 * BOX_HALF_WIDTH / TILE_GRID;
+    unsigned long long mask = 0;
+    for (int i=0; i<=TILE_SAMPLES; ++i)
+    {
+        double x, y;
+        getPathPoint(lane, from + (to - from) * i / TILE_SAMPLES, x, y);
+
+        // Tiles overlapping the square around the sample, clipped to the box
+        int firstColumn = std::max(0, (int)std::floor((x - TILE_CLEARANCE + BOX_HALF_WIDTH) / tileSize));
+        int lastColumn = std::min(TILE_GRID - 1, (int)std::floor((x + TILE_CLEARANCE + BOX_HALF_WIDTH) / tileSize));
+        int firstRow = std::max(0, (int)std::floor((y - TILE_CLEARANCE + BOX_HALF_WIDTH) / tileSize));
+        int lastRow = std::min(TILE_GRID - 1, (int)std::floor((y + TILE_CLEARANCE + BOX_HALF_WIDTH) / tileSize));
+        for (int row=firstRow; row<=lastRow; ++row)
+        {
+            for (int column=firstColumn; column<=lastColumn; ++column)
+            {
+                mask |= 1ULL << (row * TILE_GRID + column);
+            }
+        }
+    }
+    return mask;
+}
+
+/**
+ * getPathPoint
+ * Inputs:
+ *      Lane* - Pointer to a lane
+ *      double - Fraction of the crossing done
+ *      double& - Set to the x coordinate
+ *      double& - Set to the y coordinate
+ * Outputs: None
+ * Description:
+ *          Finds a point of the lane's path through the box, relative
+ *          to the middle of the intersection. The path is worked out
+ *          for source node 0, then turned a quarter for every node.
+ **/
+void Intersect4WSL::getPathPoint(Lane* lane, double progress, double& x, double& y)
+{
+    double angle = progress * M_PI / 2;
+    switch (lane->getLaneType())
+    {
+        case RIGHT:
+            x = 2 * sin(angle) - 3;
+            y = 3 - 2 * cos(angle);
+            break;
+        case LEFT:
+            x = 4 * sin(angle) - 3;
+            y = 4 * cos(angle) - 3;
+            break;
+        default:
+            x = 6 * progress - 3;
+            y = 1;
+            break;
+    }
+
+    // Turn to the source node
+    for (unsigned int i=0; i<lane->getSource()->nodeIndex; ++i)
+    {
+        double tmp = x;
+        x = y;
+        y = -tmp;
+    }
+}
\ No newline at end of file
@@ -11,24 +11,42 @@
  * Revision History:
  *      30NOV2021  R-11-30: Document Created, initial coding
  *      07DEC2021  R-12-07: Debugging and code cleanup
+ *      17OCT2026  R-10-17: Added tile geometry of the intersection box
  * 
  **/
 
 #ifndef INTERSECT4WSL_H
 #define INTERSECT4WSL_H
 
+#include <cmath>
+#include <algorithm>
+
 #include "intersection.h"
 
+// Tile geometry of the box, centered on the middle of the intersection
+#define BOX_HALF_WIDTH  3.0     // Half the width of the box
+#define TILE_GRID       6       // Tiles along each side of the box
+#define TILE_CLEARANCE  0.3     // Half the width of a vehicle
+#define TILE_SAMPLES    16      // Path samples per crossing
+
 /**
  * Intersect4WSL Class
  * Description:
- *          Class that simulates a 4-way single lane intersection
+ *          Class that simulates a 4-way single lane intersection.
+ *          Paths through the box follow the ones drawn by the display:
+ *          straight across, or a quarter circle for turns.
  **/
 class Intersect4WSL: public Intersection
 {
 public:
     // Constructors
     Intersect4WSL(unsigned int speedLimit);
+
+    // Member Functions
+    unsigned long long getTileMask(Lane* lane, double from, double to);
+
+private:
+    void getPathPoint(Lane* lane, double progress, double& x, double& y);
 };
 
 #endif
\ No newline at end of file
@@ -12,6 +12,8 @@
  *      14NOV2021  R-11-14: Document Created, initial coding
  *      01DEC2021  R-12-01: Added getters for vector sizes
  *      07DEC2021  R-12-07: Debugging and code cleanup
+ *      17OCT2026  R-10-17: Added lane table indexed by node indices
+ *      17OCT2026  R-10-17: Added allowed lane bitmasks
  * 
  **/
 
@@ -66,6 +68,78 @@ bool Intersection::isThisIntersection(std::string id)
     return false;
 }
 
+/**
+ * addNode
+ * Inputs:
+ *      Node* - Pointer to a new node, freed by the intersection
+ * Outputs: None
+ * Description:
+ *          Gives the node the next node index and stores it.
+ *          The lane table is laid out again for the new node count.
+ **/
+void Intersection::addNode(Node* node)
+{
+    node->nodeIndex = intersectionNodes.size();
+    intersectionNodes.push_back(node);
+    unsigned int numNodes = intersectionNodes.size();
+    laneTable.assign(numNodes * numNodes, NULL);
+    for (int i=0; i<intersectionLanes.size(); ++i)
+    {
+        Lane* thisLane = intersectionLanes[i];
+        laneTable[thisLane->getSource()->nodeIndex * numNodes + thisLane->getDestination()->nodeIndex] = thisLane;
+    }
+}
+
+/**
+ * addLane
+ * Inputs:
+ *      Lane* - Pointer to a new lane between nodes of this intersection,
+ *              freed by the intersection
+ * Outputs: None
+ * Description:
+ *          Gives the lane the next lane index, stores it and
+ *          enters it in the lane table
+ **/
+void Intersection::addLane(Lane* lane)
+{
+    lane->setLaneIndex(intersectionLanes.size());
+    intersectionLanes.push_back(lane);
+    laneTable[lane->getSource()->nodeIndex * intersectionNodes.size() + lane->getDestination()->nodeIndex] = lane;
+}
+
+/**
+ * buildAllowedMasks
+ * Inputs: None
+ * Outputs: None
+ * Description:
+ *          Turns every lane's allowed lane IDs into a bitmask over lane
+ *          indices, so checking two lanes is a single AND. Called once
+ *          all lanes and their allowed lanes have been added.
+ **/
+void Intersection::buildAllowedMasks()
+{
+    if (intersectionLanes.size() > MAX_MASK_LANES)
+    {
+        std::cerr << "Error in buildAllowedMasks in intersection.cpp: too many lanes for a lane mask\n";
+        return;
+    }
+    for (int i=0; i<intersectionLanes.size(); ++i)
+    {
+        Lane* thisLane = intersectionLanes[i];
+        std::vector<std::string>& allowedLanes = thisLane->getAllowedLanes();
+        unsigned long long mask = 0;
+        for (int j=0; j<allowedLanes.size(); ++j)
+        {
+            Lane* allowedLane = getLane(allowedLanes[j]);
+            if (allowedLane != NULL)
+            {
+                mask |= allowedLane->getLaneBit();
+            }
+        }
+        thisLane->setAllowedMask(mask);
+    }
+}
+
 /**
  * getNode
  * Inputs:
@@ -74,6 +148,7 @@ bool Intersection::isThisIntersection(std::string id)
  *      Node* - Pointer to a node object
  * Description:
  *          Returns pointer to requested node. Returns NULL if not found.
+ *          Scans every node, meant for I/O; use the node index otherwise.
  **/
 Node* Intersection::getNode(std::string node_id)
 {
@@ -96,6 +171,7 @@ Node* Intersection::getNode(std::string node_id)
  *      Lane* - Pointer to a lane object
  * Description:
  *          Returns pointer to requested lane. Returns NULL if not found.
+ *          Scans every lane, meant for I/O; use the lane table otherwise.
  **/
 Lane* Intersection::getLane(std::string lane_id)
 {
@@ -13,6 +13,9 @@
  *      14NOV2021  R-11-14: Document Created, initial coding
  *      01DEC2021  R-12-01: Added getters for vector sizes
  *      07DEC2021  R-12-07: Debugging and code cleanup
+ *      17OCT2026  R-10-17: Added integer node and lane lookups
+ *      17OCT2026  R-10-17: Added allowed lane bitmasks
+ *      17OCT2026  R-10-17: Added tiles swept by lanes
  * 
  **/
 
@@ -21,10 +24,17 @@
 
 #include "lane.h"
 
+// Tile mask of a whole intersection box, for intersections without tile geometry
+#define ALL_TILES (~0ULL)
+
 /**
  * Intersection Class
  * Description:
- *          Class that simulates a basic intersection
+ *          Class that simulates a basic intersection. The box where lanes
+ *          cross can be divided into up to 64 tiles, and getTileMask tells
+ *          which tiles a lane's path sweeps over part of its crossing. The
+ *          basic intersection has no geometry, so every path sweeps the
+ *          whole box.
  **/
 class Intersection
 {
@@ -33,23 +43,36 @@ public:
     Intersection(std::string id):intersectionID(id){}
 
     // Destructors
-    ~Intersection();
+    virtual ~Intersection();
 
     // Member Functions
     bool isInIntersection(unsigned int pos, std::string laneID);
     bool isThisIntersection(std::string id);
 
+    // Virtual Member Functions
+    virtual unsigned long long getTileMask(Lane* lane, double from, double to){return ALL_TILES;}
+
     // Getters
     std::string getIntersectionID(){return intersectionID;}
     unsigned int getNumNodes(){return intersectionNodes.size();}
     unsigned int getNumLanes(){return intersectionLanes.size();}
     Node* getNode(std::string node_id);
+    Node* getNode(unsigned int node_index){return intersectionNodes[node_index];}
     Lane* getLane(std::string lane_id);
+    Lane* getLane(unsigned int src_index, unsigned int dest_index){return laneTable[src_index * intersectionNodes.size() + dest_index];}
+    Lane* getLane(Node* src, Node* dest){return getLane(src->nodeIndex, dest->nodeIndex);}
+    Lane* getLaneByIndex(unsigned int lane_index){return intersectionLanes[lane_index];}
 
 protected:
+    // Helper Functions
+    void addNode(Node* node);
+    void addLane(Lane* lane);
+    void buildAllowedMasks();
+
     std::string intersectionID;             // Unique intersection identifier
     std::vector<Node*> intersectionNodes;   // Vector of all nodes belonging to this intersection
     std::vector<Lane*> intersectionLanes;   // Vector of all lanes belonging to this intersection
+    std::vector<Lane*> laneTable;           // Lanes at source index * number of nodes + destination index, NULL if none
 };
 
 #endif
\ No newline at end of file
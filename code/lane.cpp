@@ -12,6 +12,8 @@
  *      13NOV2021  R-11-13: Document Created, initial coding
  *      30NOV2021  R-11-30: Added allowed lanes functionality
  *      07DEC2021  R-12-07: Debugging and code cleanup
+ *      17OCT2026  R-10-17: Added dense lane index
+ *      17OCT2026  R-10-17: Added allowed lane bitmask
  * 
  **/
 
@@ -22,6 +24,8 @@ Lane::Lane(Node* src, Node* dest)
     :source(src), destination(dest), laneLength(DEFAULT_LANE_LENGTH), beginIntersection(DEFAULT_INTERSECTION_START), endIntersection(DEFAULT_INTERSECTION_END)
     {
         laneID = src->nodeID + "-" + dest->nodeID;
+        laneIndex = -1;
+        allowedMask = 0;
     }
 
 // Constructor - Customizable Version
@@ -29,6 +33,8 @@ Lane::Lane(Node* src, Node* dest, unsigned int length, unsigned int beginInt, un
     :source(src), destination(dest), laneLength(length), beginIntersection(beginInt), endIntersection(endInt)
     {
         laneID = src->nodeID + "-" + dest->nodeID;
+        laneIndex = -1;
+        allowedMask = 0;
     }
 
 /**
@@ -112,7 +118,8 @@ bool Lane::isThisLane(std::string lane_id)
  *      bool - True if inputted lane is allowed
  *              in the intersection simultaneously
  * Description:
- *          Checks if lane identifier is in vector of allowed lanes
+ *          Checks if lane identifier is in vector of allowed lanes.
+ *          Meant for I/O, compare masks otherwise.
  **/
 bool Lane::isAllowedLane(std::string lane_id)
 {
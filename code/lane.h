@@ -13,6 +13,8 @@
  *      13NOV2021  R-11-13: Document Created, initial coding
  *      30NOV2021  R-11-30: Added allowed lanes functionality
  *      07DEC2021  R-12-07: Debugging and code cleanup
+ *      17OCT2026  R-10-17: Added dense node and lane indices
+ *      17OCT2026  R-10-17: Added allowed lane bitmask
  * 
  **/
 
@@ -29,6 +31,9 @@
 #define DEFAULT_INTERSECTION_START 20
 #define DEFAULT_INTERSECTION_END 30
 
+// Most lanes an intersection can have, one bit each in a lane mask
+#define MAX_MASK_LANES 64
+
 /**
  * Node Struct
  * Description:
@@ -37,12 +42,14 @@
  * Contains:
  *      std::string intersectionID - Unique identifier of intersection it belongs to
  *      std::string nodeID - Unique identifier of the node itself
+ *      unsigned int nodeIndex - Dense index of the node in its intersection
  *      unsigned int speedLimit - The speed limit of the road this node signifies
  **/
 struct Node
 {
     std::string intersectionID;
     std::string nodeID;
+    unsigned int nodeIndex;
     unsigned int speedLimit;
 };
 
@@ -64,10 +71,16 @@ public:
     bool isThisLane(Node* src, Node* dest);
     bool isThisLane(std::string lane_id);
     bool isAllowedLane(std::string lane_id);
+    bool isAllowedLane(Lane* otherLane){return (allowedMask >> otherLane->laneIndex) & 1;}
+    bool isAllowedWith(unsigned long long laneSet){return (laneSet & ~allowedMask) == 0;}
     void addAllowedLane(std::string lane_id){allowedLanes.push_back(lane_id);}
 
     // Getters
     std::string getLaneID(){return laneID;}
+    unsigned int getLaneIndex(){return laneIndex;}
+    unsigned long long getLaneBit(){return 1ULL << laneIndex;}
+    unsigned long long getAllowedMask(){return allowedMask;}
+    std::vector<std::string>& getAllowedLanes(){return allowedLanes;}
     Node* getSource(){return source;}
     Node* getDestination(){return destination;}
     unsigned int getLaneLength(){return laneLength;}
@@ -77,15 +90,19 @@ public:
 
     // Setters
     void setLaneType(int type){laneType = type;}
+    void setLaneIndex(unsigned int index){laneIndex = index;}
+    void setAllowedMask(unsigned long long mask){allowedMask = mask;}
 
 private:
-    std::string laneID;                     // Unique lane identifier
+    std::string laneID;                     // Unique lane identifier, for display and I/O
+    unsigned int laneIndex;                 // Dense index of the lane in its intersection
     Node* source;                           // Pointer to source node
     Node* destination;                      // Pointer to destination node
     unsigned int laneLength;                // Full length of lane
     unsigned int beginIntersection;         // Length from start of lane to intersection
     unsigned int endIntersection;           // Length from start of lane to end of intersection
     std::vector<std::string> allowedLanes;  // Vector of lane_id's that are allowed in intersection simultaneously
+    unsigned long long allowedMask;         // Bit set at the lane index of every allowed lane
     int laneType;                           // Lane type identifier
 };
 
@@ -0,0 +1,223 @@
+/**
+ * Lane Occupancy
+ * 
+ * Authors: Marcus Chan, Raymond Jia
+ * Class: ECE 4122 - Hurley
+ * Final Project - Autonomous Traffic Simulator
+ * 
+ * Description:
+ *      Function implementation for LaneOccupancy class
+ * 
+ * Revision History:
+ *      17OCT2026  R-10-17: Document Created, initial coding
+ * 
+ **/
+
+#include "laneOccupancy.h"
+
+// Constructor
+LaneOccupancy::LaneOccupancy(unsigned int lanes)
+    :rows(OCCUPANCY_HORIZON_ROWS * lanes, 0), numLanes(lanes)
+    {
+        mask = OCCUPANCY_HORIZON_ROWS - 1;
+        baseRow = 0;
+    }
+
+/**
+ * occupy
+ * Inputs:
+ *      unsigned int - Lane index
+ *      unsigned long int - First tick reserved
+ *      unsigned long int - One past the last tick reserved
+ * Outputs: None
+ * Description:
+ *          Marks the ticks as reserved on the lane, growing the
+ *          horizon if they go beyond it
+ **/
+void LaneOccupancy::occupy(unsigned int lane, unsigned long int from, unsigned long int to)
+{
+    mark(lane, from, to, true);
+}
+
+/**
+ * release
+ * Inputs:
+ *      unsigned int - Lane index
+ *      unsigned long int - First tick reserved
+ *      unsigned long int - One past the last tick reserved
+ * Outputs: None
+ * Description:
+ *          Frees the ticks of a reservation on the lane. Reservations
+ *          on one lane must not overlap, or the other's ticks are freed too.
+ **/
+void LaneOccupancy::release(unsigned int lane, unsigned long int from, unsigned long int to)
+{
+    mark(lane, from, to, false);
+}
+
+/**
+ * earliestRun
+ * Inputs:
+ *      unsigned long long - Bit l set for every lane index l in the way
+ *      unsigned long int - Earliest first tick allowed
+ *      unsigned long int - Number of ticks needed
+ * Outputs:
+ *      unsigned long int - First tick of the earliest run of ticks free on every lane in the way
+ * Description:
+ *          Scans for the first free tick, then for the first reserved
+ *          tick after it. If that one comes before the run is long
+ *          enough the search starts over from it. Each scan skips a
+ *          whole row at a time. Rows past the horizon are free, so the
+ *          search always ends. A run of no ticks fits anywhere.
+ **/
+unsigned long int LaneOccupancy::earliestRun(unsigned long long laneMask, unsigned long int from, unsigned long int length)
+{
+    unsigned long int start = from;
+    while (length > 0)
+    {
+        // First free tick from start on
+        unsigned long int row = start / OCCUPANCY_WORD_TICKS;
+        unsigned long long freeTicks = ~busyWord(row, laneMask) & (~0ULL << (start % OCCUPANCY_WORD_TICKS));
+        if (freeTicks == 0)
+        {
+            start = (row + 1) * OCCUPANCY_WORD_TICKS;
+            continue;
+        }
+        start = row * OCCUPANCY_WORD_TICKS + __builtin_ctzll(freeTicks);
+
+        // First reserved tick after it
+        unsigned long int end = start + length;
+        unsigned long int tick = start;
+        while (tick < end)
+        {
+            row = tick / OCCUPANCY_WORD_TICKS;
+            unsigned long long busyTicks = busyWord(row, laneMask) & (~0ULL << (tick % OCCUPANCY_WORD_TICKS));
+            if (busyTicks != 0)
+            {
+                tick = row * OCCUPANCY_WORD_TICKS + __builtin_ctzll(busyTicks);
+                break;
+            }
+            tick = (row + 1) * OCCUPANCY_WORD_TICKS;
+        }
+        if (tick >= end)
+        {
+            return start;
+        }
+        start = tick;
+    }
+    return start;
+}
+
+/**
+ * advance
+ * Inputs:
+ *      unsigned long int - Current tick
+ * Outputs: None
+ * Description:
+ *          Frees the rows that ended before the current tick so the
+ *          ring can hold later rows in their place
+ **/
+void LaneOccupancy::advance(unsigned long int time)
+{
+    unsigned long int row = time / OCCUPANCY_WORD_TICKS;
+    if (row <= baseRow)
+    {
+        return;
+    }
+    if (row - baseRow > mask)
+    {
+        std::fill(rows.begin(), rows.end(), 0);
+    }
+    else
+    {
+        for (unsigned long int r=baseRow; r<row; ++r)
+        {
+            std::fill_n(rows.begin() + (r & mask) * numLanes, numLanes, 0);
+        }
+    }
+    baseRow = row;
+}
+
+/**
+ * clear
+ * Inputs: None
+ * Outputs: None
+ * Description:
+ *          Frees every tick and rewinds the bitmap to tick 0,
+ *          keeping its horizon
+ **/
+void LaneOccupancy::clear()
+{
+    std::fill(rows.begin(), rows.end(), 0);
+    baseRow = 0;
+}
+
+/**
+ * mark
+ * Inputs:
+ *      unsigned int - Lane index
+ *      unsigned long int - First tick
+ *      unsigned long int - One past the last tick
+ *      bool - Whether the ticks become reserved or free
+ * Outputs: None
+ * Description:
+ *          Sets or clears the lane's bits of the ticks still held,
+ *          one word at a time
+ **/
+void LaneOccupancy::mark(unsigned int lane, unsigned long int from, unsigned long int to, bool reserved)
+{
+    unsigned long int first = baseRow * OCCUPANCY_WORD_TICKS;
+    from = from > first ? from : first;
+    if (from >= to)
+    {
+        return;
+    }
+    unsigned long int lastRow = (to - 1) / OCCUPANCY_WORD_TICKS;
+    if (lastRow - baseRow > mask)
+    {
+        if (!reserved)
+        {
+            // Rows past the horizon are already free
+            to = (baseRow + mask + 1) * OCCUPANCY_WORD_TICKS;
+            lastRow = baseRow + mask;
+        }
+        else
+        {
+            grow(lastRow);
+        }
+    }
+    for (unsigned long int row=from/OCCUPANCY_WORD_TICKS; row<=lastRow; ++row)
+    {
+        unsigned long int rowStart = row * OCCUPANCY_WORD_TICKS;
+        unsigned long int low = from > rowStart ? from - rowStart : 0;
+        unsigned long int high = to - rowStart < OCCUPANCY_WORD_TICKS ? to - rowStart : OCCUPANCY_WORD_TICKS;
+        unsigned long long bits = (~0ULL << low) & (~0ULL >> (OCCUPANCY_WORD_TICKS - high));
+        unsigned long long& word = rows[(row & mask) * numLanes + lane];
+        word = reserved ? word | bits : word & ~bits;
+    }
+}
+
+/**
+ * grow
+ * Inputs:
+ *      unsigned long int - Latest row the bitmap must hold
+ * Outputs: None
+ * Description:
+ *          Doubles the rows held until they reach the row, moving the
+ *          held rows to their place in the larger ring
+ **/
+void LaneOccupancy::grow(unsigned long int lastRow)
+{
+    unsigned long int capacity = mask + 1;
+    while (lastRow - baseRow >= capacity)
+    {
+        capacity *= 2;
+    }
+    std::vector<unsigned long long> larger(capacity * numLanes, 0);
+    for (unsigned long int r=baseRow; r<=baseRow+mask; ++r)
+    {
+        std::copy_n(rows.begin() + (r & mask) * numLanes, numLanes, larger.begin() + (r & (capacity - 1)) * numLanes);
+    }
+    rows.swap(larger);
+    mask = capacity - 1;
+}
\ No newline at end of file
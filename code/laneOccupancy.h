@@ -0,0 +1,86 @@
+/**
+ * Lane Occupancy
+ * 
+ * Authors: Marcus Chan, Raymond Jia
+ * Class: ECE 4122 - Hurley
+ * Final Project - Autonomous Traffic Simulator
+ * 
+ * Description:
+ *      Time slot bitmap of the intersection reservations of every lane.
+ *      One bit per lane per tick tells whether the lane is reserved
+ *      during that tick. The bits of 64 ticks of every lane sit next to
+ *      each other in one row, and the rows are kept in a ring indexed by
+ *      the tick, so the lanes in the way of a crossing are merged with
+ *      one masked OR per row and the earliest free run of ticks is found
+ *      with bit scans. Finding a slot depends on the rows scanned, not on
+ *      how many pods are scheduled. Rows that have passed are cleared as the
+ *      bitmap advances, and the ring doubles when a reservation goes
+ *      beyond its horizon.
+ * 
+ * Revision History:
+ *      17OCT2026  R-10-17: Document Created, initial coding
+ * 
+ **/
+
+#ifndef LANEOCCUPANCY_H
+#define LANEOCCUPANCY_H
+
+#include <vector>
+#include <algorithm>
+
+// Ticks held by one word of the bitmap
+#define OCCUPANCY_WORD_TICKS 64
+// Starting number of rows held, 64 ticks each, grows by doubling
+#define OCCUPANCY_HORIZON_ROWS 64
+
+/**
+ * LaneOccupancy Class
+ * Description:
+ *          Ring of rows of reserved ticks, one word per lane per row.
+ *          Lanes are picked by a 64 bit mask of lane indices, so there
+ *          can be at most 64 lanes.
+ **/
+class LaneOccupancy
+{
+public:
+    // Constructors
+    LaneOccupancy(unsigned int lanes);
+
+    // Member Functions
+    void occupy(unsigned int lane, unsigned long int from, unsigned long int to);
+    void release(unsigned int lane, unsigned long int from, unsigned long int to);
+    unsigned long int earliestRun(unsigned long long laneMask, unsigned long int from, unsigned long int length);
+    void advance(unsigned long int time);
+    void clear();
+
+    // Getters
+    unsigned int getNumLanes(){return numLanes;}
+    unsigned long int getHorizon(){return (mask + 1) * OCCUPANCY_WORD_TICKS;}
+
+private:
+    // Reserved ticks of the masked lanes in the row, a row not held is free
+    unsigned long long busyWord(unsigned long int row, unsigned long long laneMask)
+    {
+        if (row < baseRow || row - baseRow > mask)
+        {
+            return 0;
+        }
+        const unsigned long long* words = &rows[(row & mask) * numLanes];
+        unsigned long long busy = 0;
+#pragma omp simd reduction(|:busy)
+        for (unsigned int l=0; l<numLanes; ++l)
+        {
+            busy |= words[l] & (0 - ((laneMask >> l) & 1ULL));
+        }
+        return busy;
+    }
+    void mark(unsigned int lane, unsigned long int from, unsigned long int to, bool reserved);
+    void grow(unsigned long int lastRow);
+
+    std::vector<unsigned long long> rows;   // Reserved ticks, numLanes words per row, row r at (r & mask) * numLanes
+    unsigned int numLanes;                  // Words per row
+    unsigned long int mask;                 // Rows held minus one
+    unsigned long int baseRow;              // Earliest row held, earlier rows are free
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,125 @@
+/**
+ * Lane Queue
+ * 
+ * Authors: Marcus Chan, Raymond Jia
+ * Class: ECE 4122 - Hurley
+ * Final Project - Autonomous Traffic Simulator
+ * 
+ * Description:
+ *      Function implementation for LaneQueue class
+ * 
+ * Revision History:
+ *      17OCT2026  R-10-17: Document Created, initial coding
+ *      17OCT2026  R-10-17: Pods removed by their sequence number
+ * 
+ **/
+
+#include "laneQueue.h"
+#include "pod.h"
+
+// Constructor
+LaneQueue::LaneQueue()
+    :buffer(LANE_QUEUE_CAPACITY, NULL)
+    {
+        mask = LANE_QUEUE_CAPACITY - 1;
+        head = 0;
+        tail = 0;
+    }
+
+/**
+ * push
+ * Inputs:
+ *      Pod* - Pointer to the pod joining the back of the queue
+ * Outputs: None
+ * Description:
+ *          Stores the pod at the tail and gives it its sequence number
+ **/
+void LaneQueue::push(Pod* thePod)
+{
+    if (tail - head > mask)
+    {
+        grow();
+    }
+    buffer[tail & mask] = thePod;
+    thePod->setQueue(this, tail);
+    tail++;
+}
+
+/**
+ * pop
+ * Inputs: None
+ * Outputs: None
+ * Description:
+ *          Removes the front pod. Every remaining pod moves up one
+ *          position without being touched.
+ **/
+void LaneQueue::pop()
+{
+    buffer[head & mask] = NULL;
+    head++;
+}
+
+/**
+ * remove
+ * Inputs:
+ *      Pod* - Pointer to a pod that may be anywhere in the queue
+ * Outputs:
+ *      bool - True if the pod was found and removed
+ * Description:
+ *          Removes a pod that leaves from the middle of the queue.
+ *          The pod is found by its sequence number, and pods behind it
+ *          are moved up and renumbered, so this is linear in the number
+ *          of pods behind it.
+ **/
+bool LaneQueue::remove(Pod* thePod)
+{
+    unsigned long int seq = thePod->getQueueSeq();
+    if (seq < head || seq >= tail || buffer[seq & mask] != thePod)
+    {
+        return false;
+    }
+    for (unsigned long int next=seq+1; next<tail; ++next)
+    {
+        buffer[(next - 1) & mask] = buffer[next & mask];
+        buffer[(next - 1) & mask]->setQueue(this, next - 1);
+    }
+    tail--;
+    buffer[tail & mask] = NULL;
+    return true;
+}
+
+/**
+ * clear
+ * Inputs: None
+ * Outputs: None
+ * Description:
+ *          Empties the queue and restarts sequence numbers, keeping capacity
+ **/
+void LaneQueue::clear()
+{
+    for (unsigned long int seq=head; seq<tail; ++seq)
+    {
+        buffer[seq & mask] = NULL;
+    }
+    head = 0;
+    tail = 0;
+}
+
+/**
+ * grow
+ * Inputs: None
+ * Outputs: None
+ * Description:
+ *          Doubles the capacity, keeping every pod at its sequence number
+ **/
+void LaneQueue::grow()
+{
+    std::vector<Pod*> larger(buffer.size() * 2, NULL);
+    unsigned long int largerMask = larger.size() - 1;
+    for (unsigned long int seq=head; seq<tail; ++seq)
+    {
+        larger[seq & largerMask] = buffer[seq & mask];
+    }
+    buffer.swap(larger);
+    mask = largerMask;
+}
\ No newline at end of file
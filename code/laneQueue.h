@@ -0,0 +1,65 @@
+/**
+ * Lane Queue
+ * 
+ * Authors: Marcus Chan, Raymond Jia
+ * Class: ECE 4122 - Hurley
+ * Final Project - Autonomous Traffic Simulator
+ * 
+ * Description:
+ *      Circular queue of the pods waiting on one approach. Every pod is
+ *      given the sequence number it was pushed at, and the queue keeps
+ *      the sequence number of its head, so a pod's position in the queue
+ *      is its sequence number minus the head. Popping only moves the
+ *      head, which shifts every position at once.
+ * 
+ * Revision History:
+ *      17OCT2026  R-10-17: Document Created, initial coding
+ * 
+ **/
+
+#ifndef LANEQUEUE_H
+#define LANEQUEUE_H
+
+#include <vector>
+
+// Starting capacity of a lane queue, grows by doubling
+#define LANE_QUEUE_CAPACITY 16
+
+class Pod;
+
+/**
+ * LaneQueue Class
+ * Description:
+ *          Ring buffer of pods with O(1) push at the back and pop at
+ *          the front. Capacity stays a power of two.
+ **/
+class LaneQueue
+{
+public:
+    // Constructors
+    LaneQueue();
+
+    // Member Functions
+    void push(Pod* thePod);
+    void pop();
+    bool remove(Pod* thePod);
+    void clear();
+
+    // Getters
+    bool empty(){return head == tail;}
+    unsigned int size(){return tail - head;}
+    unsigned long int getHead(){return head;}
+    Pod* front(){return buffer[head & mask];}
+    Pod* back(){return buffer[(tail - 1) & mask];}
+    Pod* operator[](unsigned int pos){return buffer[(head + pos) & mask];}
+
+private:
+    void grow();
+
+    std::vector<Pod*> buffer;               // Ring storage, indexed by sequence number & mask
+    unsigned long int mask;                 // Capacity minus one
+    unsigned long int head;                 // Sequence number of the front pod
+    unsigned long int tail;                 // Sequence number the next pod is pushed at
+};
+
+#endif
\ No newline at end of file
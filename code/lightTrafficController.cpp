@@ -11,6 +11,12 @@
  * 
  * Revision History:
  *      01DEC2021  R-12-01: Document Created, initial coding
+ *      17OCT2026  R-10-17: Owned light cycle thread, interruptible waits
+ *      17OCT2026  R-10-17: Pods created in the controlled pods store
+ *      17OCT2026  R-10-17: Lane lookups by node index
+ *      17OCT2026  R-10-17: Queue positions derived from lane queue sequence numbers
+ *      17OCT2026  R-10-17: Queue membership checked by pod pointer
+ *      17OCT2026  R-10-17: Departed pods retired through departPod
  * 
  **/
 
@@ -32,21 +38,11 @@ void LightTrafficController::schedulePod(Vehicle* entryVehicle)
     entryVehicle->setTrafficControl(true);
     
     // Create a pod
-    std::string lane_id = entryVehicle->getSource()->nodeID + "-" + entryVehicle->getDestination()->nodeID;
-    Lane* desiredLane = thisIntersection->getLane(lane_id);
-    std::string src_node_id = desiredLane->getSource()->nodeID;
-    Pod* entryPod = new Pod(entryVehicle, desiredLane, globalTime);
-
-    // Add to controlled pods
-    controlledPods.push_back(entryPod);
+    Lane* desiredLane = thisIntersection->getLane(entryVehicle->getSource(), entryVehicle->getDestination());
+    Pod* entryPod = controlledPods.create(entryVehicle, desiredLane, globalTime);
     
     // Add pod to lane queue
-    std::map<std::string, std::vector<Pod*>>::iterator it = laneQueues.find(src_node_id);
-    it->second.push_back(entryPod);
-    for (int i=0; i<it->second.size(); ++i)
-    {
-        it->second[i]->setPositionInQueue(i);
-    }
+    laneQueues[desiredLane->getSource()->nodeIndex].push(entryPod);
 
     // Add pod to world queue
     worldQueue.push_back(entryPod);
@@ -59,16 +55,17 @@ void LightTrafficController::schedulePod(Vehicle* entryVehicle)
  * Inputs: None
  * Outputs: None
  * Description:
- *          Loops through all controlled pods and updates their position
- *          Uses OpenMP to speed up the update process
+ *          Loops through all controlled pods and updates their position.
+ *          Pods past the end of their lane depart through departPod and
+ *          are retired with the other controllers' departures.
  **/
 void LightTrafficController::doUpdate()
 {
     if (DEBUG) {std::cout << "Entered doUpdate\n";}
 
-    // Prepare post multithreading update flags
-    bool popWorld = false;
-    bool leaveControl = false;
+    // Prepare post update flags
+    UpdateSignals signals;
+    signals.popWorld = false;
 
     for (int i=0; i<controlledPods.size(); ++i)
     {
@@ -106,45 +103,28 @@ void LightTrafficController::doUpdate()
         // Check if pod has gone through intersection square
         if (thisPod->getPosition() > thisPod->getLane()->getEndIntersection())
         {
-            std::map<std::string, std::vector<Pod*>>::iterator laneIt = laneQueues.find(thisPod->getLane()->getLaneID());
-            Pod* firstPod = laneIt->second.front();
-            if (firstPod != NULL && firstPod->getPodID() == thisPod->getPodID())
+            LaneQueue& laneQueue = laneQueues[thisPod->getLane()->getSource()->nodeIndex];
+            if (!laneQueue.empty() && laneQueue.front() == thisPod)
             {
-                laneIt->second.erase(laneIt->second.begin());
-                for (int i=0; i<laneIt->second.size(); ++i)
-                {
-                    laneIt->second[i]->setPositionInQueue(i);
-                }
+                laneQueue.pop();
             }
         }
 
         // Check if pod has left intersection
         if (thisPod->getPosition() > thisPod->getLane()->getLaneLength())
         {
+            departPod(i, signals);
             controlledPods[i] = NULL;
-            thisPod->setExitStamp(globalTime);
-            delete thisPod;
-            leaveControl = true;
         }
     }
 
-    // Signal received to pop the world queue
-    if (popWorld)
-    {
-        worldQueue.erase(worldQueue.begin());
-    }
+    applySignals(signals);
 
     // Signal received that a pod left control
-    if (leaveControl)
+    if (!signals.departed.empty())
     {
-        for (int i=0; i<controlledPods.size(); ++i)
-        {
-            if (controlledPods[i] == NULL)
-            {
-                controlledPods.erase(controlledPods.begin() + i);
-                i--;
-            }
-        }
+        removeDeparted();
+        retireDeparted(signals);
     }
 
     if (DEBUG) {std::cout << "Exited doUpdate\n";}
@@ -187,7 +167,7 @@ void LightTrafficController::startLightCycle()
     trafficLights.insert({"3-0", 1});
 
     // Start traffic light cycles thread
-    std::thread (&LightTrafficController::changingLights, this).detach();
+    controllerThreads.push_back(std::thread(&LightTrafficController::changingLights, this));
 }
 
 /**
@@ -211,7 +191,7 @@ void LightTrafficController::changingLights()
             it->second = (it->second + 1) % 8;
         }
         if (DEBUG) {std::cout << "Turns GREEN!\n";}
-        std::this_thread::sleep_for(std::chrono::seconds(3));
+        waitWhileActive(std::chrono::seconds(3));
 
         // Yellow for 3 seconds
         for (auto it = trafficLights.begin(); it != trafficLights.end(); ++it)
@@ -219,7 +199,7 @@ void LightTrafficController::changingLights()
             it->second = (it->second + 1) % 8;
         }
         if (DEBUG) {std::cout << "Turns YELLOW!\n";}
-        std::this_thread::sleep_for(std::chrono::seconds(2));
+        waitWhileActive(std::chrono::seconds(2));
 
         // Straights Phase
         lightPhase = (lightPhase + 1) % 4;
@@ -230,7 +210,7 @@ void LightTrafficController::changingLights()
             it->second = (it->second + 1) % 8;
         }
         if (DEBUG) {std::cout << "Straights GREEN!\n";}
-        std::this_thread::sleep_for(std::chrono::seconds(7));
+        waitWhileActive(std::chrono::seconds(7));
 
         // Yellow for 3 seconds
         for (auto it = trafficLights.begin(); it != trafficLights.end(); ++it)
@@ -238,6 +218,19 @@ void LightTrafficController::changingLights()
             it->second = (it->second + 1) % 8;
         }
         if (DEBUG) {std::cout << "Straights YELLOW!\n";}
-        std::this_thread::sleep_for(std::chrono::seconds(3));
+        waitWhileActive(std::chrono::seconds(3));
     }
+}
+
+/**
+ * resetState
+ * Inputs: None
+ * Outputs: None
+ * Description:
+ *          Clears the traffic lights, startLightCycle sets them up again
+ **/
+void LightTrafficController::resetState()
+{
+    lightPhase = 0;
+    trafficLights.clear();
 }
\ No newline at end of file
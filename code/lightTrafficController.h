@@ -11,6 +11,7 @@
  * 
  * Revision History:
  *      01DEC2021  R-12-01: Document Created, initial coding
+ *      17OCT2026  R-10-17: Owned light cycle thread, join before destruction
  * 
  **/
 
@@ -30,10 +31,14 @@ public:
     // Constructors
     LightTrafficController(Intersection* theIntersection, unsigned int tickSpeed):TrafficController(theIntersection, tickSpeed), lightPhase(0){}
 
+    // Destructors (threads must be joined before derived members go away)
+    ~LightTrafficController(){stopController(); joinController();}
+
     // Member Functions
     void schedulePod(Vehicle* entryVehicle);
     void doUpdate();
     void startLightCycle();
+    void resetState();
 
     // Thread Functions
     void changingLights();
@@ -16,26 +16,28 @@
  *                          to support autonomous control
  *      06DEC2021  R-12-06: Added destructor
  *      07DEC2021  R-12-07: Debugging and code cleanup
+ *      17OCT2026  R-10-17: Added event engine state and bulk advance
+ *      17OCT2026  R-10-17: Hot state moved to PodStore slot
+ *      17OCT2026  R-10-17: Allocated from a slab pool
+ *      17OCT2026  R-10-17: Queue position derived from lane queue sequence number
+ *      17OCT2026  R-10-17: Pod identity by pointer, text ID built on demand
+ *      17OCT2026  R-10-17: Speeds converted to fixed point for the store
  * 
  **/
 
 #include "pod.h"
 
 // Constructor
-Pod::Pod(Vehicle* obj, Lane* ln, unsigned long int timeAdded)
-    :vehicle(obj), lane(ln)
+Pod::Pod(Vehicle* obj, Lane* ln, unsigned long int timeAdded, PodStore* theStore, unsigned int theSlot)
+    :vehicle(obj), lane(ln), store(theStore), slot(theSlot)
     {
         timestamp = timeAdded;
-        podID = obj->getVehicleID();
-        position = 0;
-        move = false;
-        countdown = -1;
-        targetSet = false;
-        targetIntersectionEntry = -1;
-        targetIntersectionExit = -1;
         timeInIntersection = (ln->getEndIntersection() - ln->getBeginIntersection()) / ln->getDestination()->speedLimit;
-        inIntersectionSquare = false;
-        positionInQueue = -1;
+        queue = NULL;
+        queueSeq = 0;
+        syncTime = timeAdded;
+        nextEvent = timeAdded;
+        quietSpeed = 0;
         obj->setPod(this);
     }
 
@@ -77,43 +79,112 @@ unsigned long int Pod::predictedEntry(unsigned long int currentTime)
  **/
 void Pod::updatePosition(int speed, int cntdown)
 {
-    // Check if a countdown value was given
-    if (cntdown != -1)
+    store->updatePosition(slot, PodStore::toFixed(speed), cntdown);
+}
+
+/**
+ * setTarget
+ * Inputs:
+ *      unsigned long int - Desired time at which pod will reach intersection
+ *      unsigned long int - Current time
+ * Outputs: None
+ * Description:
+ *          Set the countdown value for adjusting speed to meet demand
+ **/
+void Pod::setTarget(unsigned long int desiredEntry, unsigned long int currentTime)
+{
+    unsigned long int timeDiff = desiredEntry - currentTime;
+    store->countdown[slot] = 4*timeDiff - 4*(lane->getBeginIntersection()) / (lane->getSource()->speedLimit);
+    store->entry[slot] = desiredEntry;
+    store->exit[slot] = desiredEntry + timeInIntersection;
+    store->flags[slot] |= POD_TARGET_SET;
+}
+
+/**
+ * advance
+ * Inputs:
+ *      int - Speed held throughout
+ *      unsigned long int - Number of ticks
+ * Outputs: None
+ * Description:
+ *          Same as calling updatePosition(speed) the given number
+ *          of times, done in one go
+ **/
+void Pod::advance(int speed, unsigned long int ticks)
+{
+    if (ticks == 0)
     {
-        countdown = cntdown;
+        return;
     }
-    else if (countdown > 0)
+    store->advance(slot, PodStore::toFixed(speed), ticks);
+}
+
+/**
+ * syncTo
+ * Inputs:
+ *      unsigned long int - Current time
+ * Outputs: None
+ * Description:
+ *          Applies the ticks held at quietSpeed since the
+ *          pod was last updated by the event engine
+ **/
+void Pod::syncTo(unsigned long int currentTime)
+{
+    if (currentTime > syncTime)
     {
-        countdown--;
+        advance(quietSpeed, currentTime - syncTime);
+        syncTime = currentTime;
     }
+}
 
-    // Move only if speed is positive
-    move = speed > 0;
-
-    // Move!
-    if (move)
+/**
+ * operator new
+ * Inputs:
+ *      std::size_t - Size of the object
+ * Outputs:
+ *      void* - Memory for the pod
+ * Description:
+ *          Takes a block from the pod pool. Objects larger than the
+ *          pool's blocks fall back to the global allocator.
+ **/
+void* Pod::operator new(std::size_t size)
+{
+    if (size > getPool().getBlockSize())
     {
-        position += vehicle->update(speed);
+        return ::operator new(size);
     }
-
-    // Check if in intersection square
-    inIntersectionSquare = (position > lane->getBeginIntersection() && position < lane->getEndIntersection()) ? true : false;
+    return getPool().allocate();
 }
 
 /**
- * setTarget
+ * operator delete
  * Inputs:
- *      unsigned long int - Desired time at which pod will reach intersection
- *      unsigned long int - Current time
+ *      void* - Memory of the destroyed pod
+ *      std::size_t - Size of the object
  * Outputs: None
  * Description:
- *          Set the countdown value for adjusting speed to meet demand
+ *          Returns the block to the pod pool
  **/
-void Pod::setTarget(unsigned long int desiredEntry, unsigned long int currentTime)
+void Pod::operator delete(void* block, std::size_t size)
 {
-    unsigned long int timeDiff = desiredEntry - currentTime;
-    countdown = 4*timeDiff - 4*(lane->getBeginIntersection()) / (lane->getSource()->speedLimit);
-    targetIntersectionEntry = desiredEntry;
-    targetIntersectionExit = desiredEntry + timeInIntersection;
-    targetSet = true;
+    if (size > getPool().getBlockSize())
+    {
+        ::operator delete(block);
+        return;
+    }
+    getPool().release(block);
+}
+
+/**
+ * getPool
+ * Inputs: None
+ * Outputs:
+ *      SlabPool& - Pool shared by every pod
+ * Description:
+ *          Creates the pool on first use
+ **/
+SlabPool& Pod::getPool()
+{
+    static SlabPool pool(sizeof(Pod));
+    return pool;
 }
\ No newline at end of file
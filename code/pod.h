@@ -17,6 +17,17 @@
  *                          to support autonomous control
  *      06DEC2021  R-12-06: Added destructor
  *      07DEC2021  R-12-07: Debugging and code cleanup
+ *      17OCT2026  R-10-17: Added event engine state and bulk advance
+ *      17OCT2026  R-10-17: Hot state moved to PodStore slot
+ *      17OCT2026  R-10-17: Allocated from a slab pool
+ *      17OCT2026  R-10-17: Queue position derived from lane queue sequence number
+ *      17OCT2026  R-10-17: Pod identity by pointer, text ID built on demand
+ *      17OCT2026  R-10-17: Position read from fixed point store
+ *      17OCT2026  R-10-17: Added speed getter
+ *      17OCT2026  R-10-17: Added reservation flag
+ *      17OCT2026  R-10-17: Removed reservation flag, held by the controller instead
+ *      17OCT2026  R-10-17: First tick held by the reservation kept in the store
+ *      17OCT2026  R-10-17: Queue membership read from the sequence number
  * 
  **/
 
@@ -24,18 +35,24 @@
 #define POD_H
 
 #include "vehicle.h"
+#include "podStore.h"
+#include "laneQueue.h"
 #include <ctime>
 
 /**
  * Pod Class
  * Description:
- *          Class that simulates a pod communicating between traffic controller and vehicle
+ *          Class that simulates a pod communicating between traffic controller and vehicle.
+ *          Created by a PodStore, which holds its position, countdown,
+ *          targets and flags. new and delete recycle pods through a
+ *          shared slab pool. Pods are compared by pointer; the text ID
+ *          is the vehicle's and is only built when asked for.
  **/
 class Pod
 {
 public:
     // Constructors
-    Pod(Vehicle* obj, Lane* ln, unsigned long int timeAdded = -1);
+    Pod(Vehicle* obj, Lane* ln, unsigned long int timeAdded, PodStore* theStore, unsigned int theSlot);
 
     // Destructors
     ~Pod();
@@ -44,49 +61,64 @@ public:
     unsigned long int predictedEntry(unsigned long int currentTime);
     void updatePosition(int speed, int cntdown = -1);
     void setTarget(unsigned long int desiredEntry, unsigned long int currentTime);
+    void advance(int speed, unsigned long int ticks);
+    void syncTo(unsigned long int currentTime);
+
+    // Pool Allocation
+    static void* operator new(std::size_t size);
+    static void operator delete(void* block, std::size_t size);
+    static SlabPool& getPool();
     
     // Setters
-    void setPositionInQueue(int pos){positionInQueue = pos;}
+    void setQueue(LaneQueue* theQueue, unsigned long int seq){queue = theQueue; queueSeq = seq;}
     void setExitStamp(unsigned long int exit){exitstamp = exit;}
+    void setEventState(unsigned long int sync, unsigned long int next, int speed){syncTime = sync; nextEvent = next; quietSpeed = speed;}
+    void setSlot(unsigned int theSlot){slot = theSlot;}
+    void setHeld(unsigned long int from){store->held[slot] = from;}
 
     // Getters
-    std::string getPodID(){return podID;}
+    std::string getPodID(){return vehicle->getVehicleID();}
+    unsigned long int getPodNumber(){return vehicle->getVehicleNumber();}
     unsigned long int getTimestamp(){return timestamp;}
     unsigned long int getExitstamp(){return exitstamp;}
     unsigned long int getWaitTime(){return waitTime;}
     Vehicle* getVehicle(){return vehicle;}
     Lane* getLane(){return lane;}
-    double getPosition(){return position;}
-    int getCountdown(){return countdown;}
-    bool isTargetSet(){return targetSet;}
-    unsigned long int getEntry(){return targetIntersectionEntry;}
-    unsigned long int getExit(){return targetIntersectionExit;}
+    double getPosition(){return PodStore::toUnits(store->position[slot]);}
+    double getSpeed(){return PodStore::toUnits(store->currentSpeed[slot]);}
+    int getCountdown(){return store->countdown[slot];}
+    bool isTargetSet(){return store->flags[slot] & POD_TARGET_SET;}
+    unsigned long int getEntry(){return store->entry[slot];}
+    unsigned long int getExit(){return store->exit[slot];}
+    unsigned long int getHeld(){return store->held[slot];}
     unsigned long int getTimeInIntersection(){return timeInIntersection;}
-    bool getInIntersectionSquare(){return inIntersectionSquare;}
-    int getPositionInQueue(){return positionInQueue;}
+    bool getInIntersectionSquare(){return store->flags[slot] & POD_IN_SQUARE;}
+    unsigned int getSlot(){return slot;}
+    int getPositionInQueue(){return queue == NULL ? -1 : queueSeq < queue->getHead() ? 0 : queueSeq - queue->getHead();}
+    unsigned long int getQueueSeq(){return queueSeq;}
+    bool isQueued(){return queue != NULL && queueSeq >= queue->getHead();}
+    unsigned long int getNextEvent(){return nextEvent;}
 
 private:
-    std::string podID;              // Unique pod identifier
     unsigned long int timestamp;    // Entry timestamp
     unsigned long int exitstamp;    // Exit timestamp
     unsigned long int waitTime;     // Exit - Entry - Expected delay
     Vehicle* vehicle;               // Pointer to vehicle it controls
     Lane* lane;                     // Pointer to lane it is in
-    double position;                // Linear position in lane
-
-    // Instructors
-    bool move;                      // Check if pod is moving
-    int countdown;                  // Countdown for speed adjustment
+    PodStore* store;                // Pointer to store holding the hot state
+    unsigned int slot;              // Slot of the pod in the store
 
     // Targets
-    bool targetSet;                             // Check if a target is set
-    unsigned long int targetIntersectionEntry;  // Intersection entry target
-    unsigned long int targetIntersectionExit;   // Intersection exit target
     unsigned long int timeInIntersection;       // Expected time in intersection
 
     // Status
-    bool inIntersectionSquare;      // Check if pod is in intersection square
-    int positionInQueue;            // Position of pod in its lane queue
+    LaneQueue* queue;               // Lane queue the pod was pushed on, NULL if none
+    unsigned long int queueSeq;     // Sequence number in the lane queue, minus its head gives the position
+
+    // Event Engine
+    unsigned long int syncTime;     // Tick from which position is not yet applied
+    unsigned long int nextEvent;    // Tick at which pod must next be updated
+    int quietSpeed;                 // Speed held until next event
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,291 @@
+/**
+ * Pod Store
+ * 
+ * Authors: Marcus Chan, Raymond Jia
+ * Class: ECE 4122 - Hurley
+ * Final Project - Autonomous Traffic Simulator
+ * 
+ * Description:
+ *      Function implementation for PodStore class
+ * 
+ * Revision History:
+ *      17OCT2026  R-10-17: Document Created, initial coding
+ *      17OCT2026  R-10-17: Lane table indexed by lane index
+ *      17OCT2026  R-10-17: Pods bucketed by phase
+ *      17OCT2026  R-10-17: Fixed point positions and speeds
+ *      17OCT2026  R-10-17: Batched moves bounded by vehicle acceleration
+ *      17OCT2026  R-10-17: Batched moves bounded by vehicle deceleration
+ *      17OCT2026  R-10-17: Added first tick held by the reservation
+ * 
+ **/
+
+#include "podStore.h"
+#include "pod.h"
+
+/**
+ * create
+ * Inputs:
+ *      Vehicle* - Pointer to the vehicle the pod controls
+ *      Lane* - Pointer to the lane the pod is in
+ *      unsigned long int - Entry timestamp
+ * Outputs:
+ *      Pod* - Pointer to the new pod, freed by the caller with delete
+ * Description:
+ *          Appends a slot with the pod's starting state and creates the pod
+ **/
+Pod* PodStore::create(Vehicle* obj, Lane* ln, unsigned long int timeAdded)
+{
+    unsigned int slot = pods.size();
+    position.push_back(0);
+    countdown.push_back(-1);
+    entry.push_back(-1);
+    exit.push_back(-1);
+    held.push_back(POD_NOT_HELD);
+    flags.push_back(0);
+    laneIndex.push_back(laneIndexOf(ln));
+    phase.push_back(phaseOf(0, lanes[laneIndex[slot]]));
+    currentSpeed.push_back(roundFixed(obj->getCurrentSpeed()));
+    wantedSpeed.push_back(0);
+    acceleration.push_back(limitAcceleration ? roundFixed(obj->getAcceleration()) : SPEED_UNLIMITED);
+    deceleration.push_back(limitAcceleration ? roundFixed(obj->getDeceleration()) : SPEED_UNLIMITED);
+    topSpeed.push_back(limitAcceleration ? roundFixed(obj->getMaxSpeed()) : SPEED_UNLIMITED);
+    turnSpeed.push_back(limitAcceleration ? roundFixed(obj->getMaxTurnSpeed()) : SPEED_UNLIMITED);
+    buckets[phase[slot]].push_back(slot);
+    Pod* newPod = new Pod(obj, ln, timeAdded, this, slot);
+    pods.push_back(newPod);
+    return newPod;
+}
+
+/**
+ * compact
+ * Inputs: None
+ * Outputs: None
+ * Description:
+ *          Removes empty slots in one pass, keeping the order of the rest
+ *          and telling moved pods their new slot. The phase buckets are
+ *          refilled in slot order.
+ **/
+void PodStore::compact()
+{
+    unsigned int kept = 0;
+    for (unsigned int i=0; i<pods.size(); ++i)
+    {
+        if (pods[i] == NULL)
+        {
+            continue;
+        }
+        if (kept != i)
+        {
+            pods[kept] = pods[i];
+            position[kept] = position[i];
+            countdown[kept] = countdown[i];
+            entry[kept] = entry[i];
+            exit[kept] = exit[i];
+            held[kept] = held[i];
+            flags[kept] = flags[i];
+            laneIndex[kept] = laneIndex[i];
+            phase[kept] = phase[i];
+            currentSpeed[kept] = currentSpeed[i];
+            wantedSpeed[kept] = wantedSpeed[i];
+            acceleration[kept] = acceleration[i];
+            deceleration[kept] = deceleration[i];
+            topSpeed[kept] = topSpeed[i];
+            turnSpeed[kept] = turnSpeed[i];
+            pods[kept]->setSlot(kept);
+        }
+        kept++;
+    }
+    pods.resize(kept);
+    position.resize(kept);
+    countdown.resize(kept);
+    entry.resize(kept);
+    exit.resize(kept);
+    held.resize(kept);
+    flags.resize(kept);
+    laneIndex.resize(kept);
+    phase.resize(kept);
+    currentSpeed.resize(kept);
+    wantedSpeed.resize(kept);
+    acceleration.resize(kept);
+    deceleration.resize(kept);
+    topSpeed.resize(kept);
+    turnSpeed.resize(kept);
+    for (unsigned int p=0; p<POD_PHASES; ++p)
+    {
+        buckets[p].clear();
+    }
+    for (unsigned int i=0; i<kept; ++i)
+    {
+        buckets[phase[i]].push_back(i);
+    }
+}
+
+/**
+ * clear
+ * Inputs: None
+ * Outputs: None
+ * Description:
+ *          Empties every slot, keeping capacity and the lane table.
+ *          Pods must have been freed by the caller.
+ **/
+void PodStore::clear()
+{
+    pods.clear();
+    position.clear();
+    countdown.clear();
+    entry.clear();
+    exit.clear();
+    held.clear();
+    flags.clear();
+    laneIndex.clear();
+    phase.clear();
+    currentSpeed.clear();
+    wantedSpeed.clear();
+    acceleration.clear();
+    deceleration.clear();
+    topSpeed.clear();
+    turnSpeed.clear();
+    for (unsigned int p=0; p<POD_PHASES; ++p)
+    {
+        buckets[p].clear();
+    }
+}
+
+/**
+ * sortBuckets
+ * Inputs: None
+ * Outputs: None
+ * Description:
+ *          Moves slots whose phase changed to the bucket of their new
+ *          phase. Phases only ever go up, so a slot moved forward is
+ *          checked again when its new bucket is swept.
+ **/
+void PodStore::sortBuckets()
+{
+    for (unsigned int p=0; p<POD_PHASES; ++p)
+    {
+        std::vector<unsigned int>& bucket = buckets[p];
+        unsigned int kept = 0;
+        for (unsigned int k=0; k<bucket.size(); ++k)
+        {
+            unsigned int slot = bucket[k];
+            if (phase[slot] == p)
+            {
+                bucket[kept++] = slot;
+            }
+            else
+            {
+                buckets[phase[slot]].push_back(slot);
+            }
+        }
+        bucket.resize(kept);
+    }
+}
+
+/**
+ * applyMoves
+ * Inputs: None
+ * Outputs: None
+ * Description:
+ *          Moves every slot at the speed it asked for while moves were
+ *          held. Large stores are split into one run of slots per thread.
+ **/
+void PodStore::applyMoves()
+{
+    int N = pods.size();
+    if (N < PARALLEL_MOVES)
+    {
+        moveSlots(0, N);
+        return;
+    }
+#pragma omp parallel
+    {
+        int T = omp_get_num_threads();
+        int t = omp_get_thread_num();
+        moveSlots((long long int)N * t / T, (long long int)N * (t + 1) / T);
+    }
+}
+
+/**
+ * moveSlots
+ * Inputs:
+ *      int - First slot to move
+ *      int - One past the last slot to move
+ * Outputs: None
+ * Description:
+ *          Same as moveBy for one tick at the wanted speed of every slot
+ *          in the run, written over the raw arrays so the compiler can
+ *          vectorize it
+ **/
+void PodStore::moveSlots(int first, int last)
+{
+    int* pos = position.data();
+    int* speed = currentSpeed.data();
+    const int* wanted = wantedSpeed.data();
+    const int* accel = acceleration.data();
+    const int* decel = deceleration.data();
+    const int* top = topSpeed.data();
+    const int* turn = turnSpeed.data();
+    const unsigned int* lane = laneIndex.data();
+    unsigned char* podFlags = flags.data();
+    unsigned char* podPhase = phase.data();
+    const LaneBounds* bounds = lanes.data();
+#pragma omp simd
+    for (int i=first; i<last; ++i)
+    {
+        // Speed up by at most the acceleration, slow down by at most the deceleration
+        int limit = podPhase[i] == POD_INSIDE ? turn[i] : top[i];
+        int reach = speed[i] + accel[i];
+        int floor = speed[i] - decel[i];
+        int s = wanted[i] < reach ? wanted[i] : reach;
+        s = s < limit ? s : limit;
+        s = s > floor ? s : floor;
+        s = s > 0 ? s : 0;
+        speed[i] = s;
+        pos[i] += s;
+
+        // Flags and phase from the new position
+        int p = pos[i];
+        const LaneBounds& b = bounds[lane[i]];
+        podFlags[i] = (podFlags[i] & ~(POD_MOVING | POD_IN_SQUARE))
+                    | (s > 0 ? POD_MOVING : 0)
+                    | (p > b.beginFixed && p < b.endFixed ? POD_IN_SQUARE : 0);
+        podPhase[i] = (p >= b.beginFixed) + (p > b.beginFixed) + (p > b.endFixed) + (p > b.lengthFixed);
+    }
+}
+
+/**
+ * laneIndexOf
+ * Inputs:
+ *      Lane* - Pointer to a lane
+ * Outputs:
+ *      unsigned int - Index of the lane in the lane table
+ * Description:
+ *          Returns the lane's index, copying its bounds into the
+ *          lane table the first time the lane is seen
+ **/
+unsigned int PodStore::laneIndexOf(Lane* ln)
+{
+    unsigned int index = ln->getLaneIndex();
+    if (index >= lanes.size())
+    {
+        lanes.resize(index + 1, LaneBounds());
+    }
+    if (lanes[index].lane == NULL)
+    {
+        LaneBounds& bounds = lanes[index];
+        bounds.laneLength = ln->getLaneLength();
+        bounds.beginIntersection = ln->getBeginIntersection();
+        bounds.endIntersection = ln->getEndIntersection();
+        bounds.approachSpeed = ln->getSource()->speedLimit;
+        bounds.exitSpeed = ln->getDestination()->speedLimit;
+        bounds.lengthFixed = toFixed(bounds.laneLength);
+        bounds.beginFixed = toFixed(bounds.beginIntersection);
+        bounds.endFixed = toFixed(bounds.endIntersection);
+        bounds.approachFixed = toFixed(bounds.approachSpeed);
+        bounds.exitFixed = toFixed(bounds.exitSpeed);
+        bounds.sourceIndex = ln->getSource()->nodeIndex;
+        bounds.lane = ln;
+    }
+    return index;
+}
\ No newline at end of file
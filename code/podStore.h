@@ -0,0 +1,289 @@
+/**
+ * Pod Store
+ * 
+ * Authors: Marcus Chan, Raymond Jia
+ * Class: ECE 4122 - Hurley
+ * Final Project - Autonomous Traffic Simulator
+ * 
+ * Description:
+ *      Struct-of-arrays table holding the state of every pod under a traffic
+ *      controller. Each pod owns one slot, and the fields touched every tick
+ *      (position, countdown, targets, flags and lane index) live in their own
+ *      contiguous arrays, so an update pass streams through memory instead
+ *      of following pointers. Lane bounds and speed limits are copied once
+ *      into a small lane table indexed by lane index. Pod objects keep the cold data and read and
+ *      write their hot fields through their slot. Positions and speeds are
+ *      held in fixed point, POSITION_ONE steps to a lane unit, so updates
+ *      are exact integer adds that give the same result on every compiler
+ *      and thread count. Every move goes through the pod's acceleration,
+ *      deceleration and top speeds, which are unlimited unless asked for.
+ * 
+ * Revision History:
+ *      17OCT2026  R-10-17: Document Created, initial coding
+ *      17OCT2026  R-10-17: Lane table indexed by lane index
+ *      17OCT2026  R-10-17: Pods bucketed by phase
+ *      17OCT2026  R-10-17: Fixed point positions and speeds
+ *      17OCT2026  R-10-17: Batched moves bounded by vehicle acceleration
+ *      17OCT2026  R-10-17: Added reservation flag
+ *      17OCT2026  R-10-17: Moves bounded by vehicle deceleration, stopping speeds
+ *      17OCT2026  R-10-17: Removed reservation flag
+ *      17OCT2026  R-10-17: Added first tick held by the reservation
+ * 
+ **/
+
+#ifndef PODSTORE_H
+#define PODSTORE_H
+
+#include <vector>
+#include <climits>
+#include <omp.h>
+
+#include "lane.h"
+#include "vehicle.h"
+
+// Pod flag bits
+#define POD_MOVING      0x01
+#define POD_TARGET_SET  0x02
+#define POD_IN_SQUARE   0x04
+
+// First tick held of a pod without a reservation
+#define POD_NOT_HELD    ULONG_MAX
+
+// Pod phases, in the order a pod goes through them
+#define POD_APPROACHING 0       // Before the intersection
+#define POD_WAITING     1       // Exactly at the start of the intersection
+#define POD_INSIDE      2       // In the intersection
+#define POD_EXITING     3       // Past the intersection, still in the lane
+#define POD_DEPARTING   4       // Past the end of the lane
+#define POD_PHASES      5
+
+// Fixed point positions, POSITION_ONE steps to a lane unit
+#define POSITION_SHIFT  8
+#define POSITION_ONE    (1 << POSITION_SHIFT)
+
+// Speed bounds of pods without acceleration limits, leaves room to add to a speed
+#define SPEED_UNLIMITED (INT_MAX / 4)
+
+// Pods needed before applyMoves shares the work among threads
+#define PARALLEL_MOVES  4096
+
+class Pod;
+
+/**
+ * LaneBounds Struct
+ * Description:
+ *          Data structure for the lane data pods read every tick
+ * Contains:
+ *      unsigned int laneLength - Full length of lane
+ *      unsigned int beginIntersection - Length from start of lane to intersection
+ *      unsigned int endIntersection - Length from start of lane to end of intersection
+ *      unsigned int approachSpeed - Speed limit of the source node
+ *      unsigned int exitSpeed - Speed limit of the destination node
+ *      int lengthFixed - laneLength in fixed point
+ *      int beginFixed - beginIntersection in fixed point
+ *      int endFixed - endIntersection in fixed point
+ *      int approachFixed - approachSpeed in fixed point
+ *      int exitFixed - exitSpeed in fixed point
+ *      unsigned int sourceIndex - Index of the source node
+ *      Lane* lane - Pointer to the lane
+ **/
+struct LaneBounds
+{
+    unsigned int laneLength;
+    unsigned int beginIntersection;
+    unsigned int endIntersection;
+    unsigned int approachSpeed;
+    unsigned int exitSpeed;
+    int lengthFixed;
+    int beginFixed;
+    int endFixed;
+    int approachFixed;
+    int exitFixed;
+    unsigned int sourceIndex;
+    Lane* lane;
+};
+
+/**
+ * PodStore Class
+ * Description:
+ *          Class that creates pods and stores their hot state by slot.
+ *          Slots stay in creation order; departed pods leave an empty
+ *          slot that compact squeezes out. Slots are also kept in one
+ *          bucket per phase so an update pass can run the same code
+ *          over a whole bucket. Phases are recomputed whenever a pod
+ *          moves and sortBuckets moves the slots that crossed a boundary.
+ *          A move never speeds a pod up by more than its acceleration or
+ *          beyond its top speed, which is its turning speed inside the
+ *          intersection, and never slows it down by more than its
+ *          deceleration. A pod that has to stop at a target asks for
+ *          its stopping speed, so it brakes in time. While moves are held
+ *          the wanted speeds are only recorded, and applyMoves then moves
+ *          every pod in one vectorized pass over the arrays.
+ **/
+class PodStore
+{
+public:
+    // Constructors
+    PodStore():limitAcceleration(false), deferMoves(false){}
+
+    // Member Functions
+    Pod* create(Vehicle* obj, Lane* ln, unsigned long int timeAdded);
+    void compact();
+    void clear();
+    void sortBuckets();
+    void applyMoves();
+    unsigned int laneIndexOf(Lane* ln);
+
+    // Fixed Point Conversion
+    static int toFixed(int units){return units * POSITION_ONE;}
+    static int roundFixed(double units){return (int)(units * POSITION_ONE + 0.5);}
+    static double toUnits(int fixed){return (double)fixed / POSITION_ONE;}
+
+    // Kinematics in fixed point (same as Pod::updatePosition and Pod::advance)
+    void updatePosition(unsigned int slot, int speed, int cntdown = -1)
+    {
+        // Check if a countdown value was given
+        if (cntdown != -1)
+        {
+            countdown[slot] = cntdown;
+        }
+        else if (countdown[slot] > 0)
+        {
+            countdown[slot]--;
+        }
+        // Held moves are made by applyMoves
+        if (deferMoves)
+        {
+            wantedSpeed[slot] = speed;
+        }
+        else
+        {
+            moveBy(slot, speed, 1);
+        }
+    }
+    void advance(unsigned int slot, int speed, unsigned long int ticks)
+    {
+        // Countdown runs out but never goes below zero
+        if (countdown[slot] > 0)
+        {
+            countdown[slot] = (unsigned long int)countdown[slot] > ticks ? countdown[slot] - ticks : 0;
+        }
+        moveBy(slot, speed, ticks);
+    }
+    int limitedSpeed(unsigned int slot, int speed)
+    {
+        int top = phase[slot] == POD_INSIDE ? turnSpeed[slot] : topSpeed[slot];
+        int reach = currentSpeed[slot] + acceleration[slot];
+        speed = speed < reach ? speed : reach;
+        speed = speed < top ? speed : top;
+        int floor = currentSpeed[slot] - deceleration[slot];
+        speed = speed > floor ? speed : floor;
+        return speed > 0 ? speed : 0;
+    }
+    static int brakingDistance(int speed, int braking)
+    {
+        // Distance moved at the speed, then slowing by the braking each tick until stopped
+        if (braking <= 0)
+        {
+            return speed > 0 ? INT_MAX : 0;
+        }
+        long long int steps = speed > 0 ? (speed - 1) / braking : 0;
+        return (int)((steps + 1) * speed - braking * steps * (steps + 1) / 2);
+    }
+    int stoppingDistance(unsigned int slot, int speed){return brakingDistance(speed, deceleration[slot]);}
+    int stoppingSpeed(unsigned int slot, int distance)
+    {
+        // Fastest speed this tick that still stops within the distance
+        int braking = deceleration[slot];
+        if (distance <= braking)
+        {
+            return distance > 0 ? distance : 0;
+        }
+        int low = braking;
+        int high = distance;
+        while (low < high)
+        {
+            int mid = low + (high - low + 1) / 2;
+            if (brakingDistance(mid, braking) <= distance)
+            {
+                low = mid;
+            }
+            else
+            {
+                high = mid - 1;
+            }
+        }
+        return low;
+    }
+
+    // Setters
+    void setAccelerationLimited(bool limited){limitAcceleration = limited;}
+    void holdMoves(bool hold){deferMoves = hold;}
+
+    // Getters
+    bool isAccelerationLimited(){return limitAcceleration;}
+    bool isSteady(unsigned int slot, int speed){return !limitAcceleration || limitedSpeed(slot, speed) == currentSpeed[slot];}
+    unsigned int size(){return pods.size();}
+    bool empty(){return pods.empty();}
+    Pod*& operator[](unsigned int slot){return pods[slot];}
+    LaneBounds& getBounds(unsigned int slot){return lanes[laneIndex[slot]];}
+    std::vector<unsigned int>& getBucket(unsigned int podPhase){return buckets[podPhase];}
+
+public:
+    // Cold handle of every slot, NULL once the pod has departed
+    std::vector<Pod*> pods;
+
+    // Hot state by slot
+    std::vector<int> position;                  // Linear position in lane, in fixed point
+    std::vector<int> countdown;                 // Countdown for speed adjustment
+    std::vector<unsigned long int> entry;       // Intersection entry target
+    std::vector<unsigned long int> exit;        // Intersection exit target
+    std::vector<unsigned long int> held;        // First tick of the reservation held, POD_NOT_HELD if none
+    std::vector<unsigned char> flags;           // POD_ flag bits
+    std::vector<unsigned int> laneIndex;        // Lane index of the pod's lane
+    std::vector<unsigned char> phase;           // POD_ phase, from the position and lane bounds
+    std::vector<int> currentSpeed;              // Speed of the last move, in fixed point
+    std::vector<int> wantedSpeed;               // Speed asked for while moves are held
+    std::vector<int> acceleration;              // Most the speed can go up in one tick
+    std::vector<int> deceleration;              // Most the speed can go down in one tick
+    std::vector<int> topSpeed;                  // Most the speed can be outside the intersection
+    std::vector<int> turnSpeed;                 // Most the speed can be inside the intersection
+
+    // Lane table by lane index, lane is NULL for lanes not seen yet
+    std::vector<LaneBounds> lanes;
+
+private:
+    void moveSlots(int first, int last);
+    void moveBy(unsigned int slot, int speed, unsigned long int ticks)
+    {
+        speed = limitedSpeed(slot, speed);
+        currentSpeed[slot] = speed;
+        unsigned char podFlags = flags[slot] & ~(POD_MOVING | POD_IN_SQUARE);
+        // Move only if speed is positive
+        if (speed > 0)
+        {
+            podFlags |= POD_MOVING;
+            position[slot] += (int)(speed * ticks);
+        }
+        // Check if in intersection square
+        LaneBounds& bounds = lanes[laneIndex[slot]];
+        if (position[slot] > bounds.beginFixed && position[slot] < bounds.endFixed)
+        {
+            podFlags |= POD_IN_SQUARE;
+        }
+        flags[slot] = podFlags;
+        phase[slot] = phaseOf(position[slot], bounds);
+    }
+    unsigned char phaseOf(int pos, LaneBounds& bounds)
+    {
+        // Each boundary passed adds one, no branches
+        return (pos >= bounds.beginFixed) + (pos > bounds.beginFixed)
+             + (pos > bounds.endFixed) + (pos > bounds.lengthFixed);
+    }
+
+    std::vector<unsigned int> buckets[POD_PHASES];  // Slots by phase, in slot order after compact
+    bool limitAcceleration;                     // Whether new pods take the limits of their vehicle
+    bool deferMoves;                            // Whether updatePosition only records the wanted speed
+};
+
+#endif
\ No newline at end of file
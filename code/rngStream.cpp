@@ -0,0 +1,124 @@
+/**
+ * RNG Stream
+ * 
+ * Authors: Marcus Chan, Raymond Jia
+ * Class: ECE 4122 - Hurley
+ * Final Project - Autonomous Traffic Simulator
+ * 
+ * Description:
+ *      Function implementation for RngStream class
+ * 
+ * Revision History:
+ *      17OCT2026  R-10-17: Document Created, initial coding
+ * 
+ **/
+
+#include "rngStream.h"
+
+// Philox4x32 Constants
+#define PHILOX_M0       0xD2511F53u
+#define PHILOX_M1       0xCD9E8D57u
+#define PHILOX_W0       0x9E3779B9u
+#define PHILOX_W1       0xBB67AE85u
+#define PHILOX_ROUNDS   10
+
+// Constructor
+RngStream::RngStream(uint32_t seed, uint32_t replication, uint32_t stream)
+    :streamID(stream)
+    {
+        key[0] = seed;
+        key[1] = replication;
+        block = 0;
+        used = 4;
+    }
+
+/**
+ * next
+ * Inputs: None
+ * Outputs:
+ *      uint32_t - Next 32 random bits of the stream
+ **/
+uint32_t RngStream::next()
+{
+    if (used == 4)
+    {
+        refill();
+    }
+    return buffer[used++];
+}
+
+/**
+ * uniform
+ * Inputs: None
+ * Outputs:
+ *      double - Uniform value in the open interval (0, 1)
+ * Description:
+ *          Uses two draws for 53 bits of precision
+ **/
+double RngStream::uniform()
+{
+    uint64_t hi = next() >> 5;
+    uint64_t lo = next() >> 6;
+    return ((hi << 26 | lo) + 0.5) / 9007199254740992.0;
+}
+
+/**
+ * exponential
+ * Inputs:
+ *      double - Rate of the distribution
+ * Outputs:
+ *      double - Exponentially distributed value with mean 1/rate
+ **/
+double RngStream::exponential(double rate)
+{
+    return -std::log(uniform()) / rate;
+}
+
+/**
+ * below
+ * Inputs:
+ *      unsigned int - Exclusive upper bound, must be positive
+ * Outputs:
+ *      unsigned int - Value in [0, n) by multiply and shift
+ **/
+unsigned int RngStream::below(unsigned int n)
+{
+    return (unsigned int)(((uint64_t)next() * n) >> 32);
+}
+
+/**
+ * refill
+ * Inputs: None
+ * Outputs: None
+ * Description:
+ *          Encrypts the counter (block, streamID, 0) with ten Philox
+ *          rounds and stores the four outputs in the buffer
+ **/
+void RngStream::refill()
+{
+    uint32_t c0 = (uint32_t)block;
+    uint32_t c1 = (uint32_t)(block >> 32);
+    uint32_t c2 = streamID;
+    uint32_t c3 = 0;
+    uint32_t k0 = key[0];
+    uint32_t k1 = key[1];
+    for (int i=0; i<PHILOX_ROUNDS; ++i)
+    {
+        uint64_t p0 = (uint64_t)PHILOX_M0 * c0;
+        uint64_t p1 = (uint64_t)PHILOX_M1 * c2;
+        uint32_t n0 = (uint32_t)(p1 >> 32) ^ c1 ^ k0;
+        uint32_t n2 = (uint32_t)(p0 >> 32) ^ c3 ^ k1;
+        c1 = (uint32_t)p1;
+        c3 = (uint32_t)p0;
+        c0 = n0;
+        c2 = n2;
+        k0 += PHILOX_W0;
+        k1 += PHILOX_W1;
+    }
+    buffer[0] = c0;
+    buffer[1] = c1;
+    buffer[2] = c2;
+    buffer[3] = c3;
+    block++;
+    used = 0;
+}
\ No newline at end of file
@@ -0,0 +1,71 @@
+/**
+ * RNG Stream
+ * 
+ * Authors: Marcus Chan, Raymond Jia
+ * Class: ECE 4122 - Hurley
+ * Final Project - Autonomous Traffic Simulator
+ * 
+ * Description:
+ *      Counter-based random number streams built on Philox4x32-10.
+ *      A stream is fully determined by the simulation seed, the replication
+ *      number and a stream number, and its n-th draw is a pure function of
+ *      those and n. Streams never share state, so each approach, vehicle
+ *      attribute and replication can draw from its own stream on any thread
+ *      and runs stay bit-reproducible.
+ * 
+ * Revision History:
+ *      17OCT2026  R-10-17: Document Created, initial coding
+ * 
+ **/
+
+#ifndef RNGSTREAM_H
+#define RNGSTREAM_H
+
+#include <cstdint>
+#include <cmath>
+
+// Vehicle attributes with their own stream at each approach
+#define STREAM_HEADWAY      0
+#define STREAM_DESTINATION  1
+#define STREAM_ATTRIBUTES   2
+
+// Stream numbers from here up are free for tests and tools
+#define STREAM_USER         0x80000000u
+
+/**
+ * RngStream Class
+ * Description:
+ *          Class for drawing from one independent random stream.
+ *          Draws are generated four at a time by encrypting a block
+ *          counter with the seed and replication as the key.
+ **/
+class RngStream
+{
+public:
+    // Constructors
+    RngStream(uint32_t seed = 0, uint32_t replication = 0, uint32_t stream = 0);
+
+    // Member Functions
+    uint32_t next();
+    double uniform();
+    double exponential(double rate);
+    unsigned int below(unsigned int n);
+
+    // Helper Functions
+    static uint32_t approachStream(unsigned int approach, unsigned int attribute)
+        {return approach * STREAM_ATTRIBUTES + attribute;}
+
+    // Getters
+    uint64_t getDraws(){return block * 4 + used - 4;}
+
+private:
+    void refill();
+
+    uint32_t key[2];                        // Seed and replication
+    uint32_t streamID;                      // Stream number within the replication
+    uint64_t block;                         // Index of the next counter block
+    uint32_t buffer[4];                     // Outputs of the last block
+    unsigned int used;                      // Outputs of the buffer already drawn
+};
+
+#endif
\ No newline at end of file
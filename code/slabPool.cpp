@@ -0,0 +1,327 @@
+/**
+ * Slab Pool
+ * 
+ * Authors: Marcus Chan, Raymond Jia
+ * Class: ECE 4122 - Hurley
+ * Final Project - Autonomous Traffic Simulator
+ * 
+ * Description:
+ *      Function implementation for SlabPool class
+ * 
+ * Revision History:
+ *      17OCT2026  R-10-17: Document Created, initial coding
+ *      17OCT2026  R-10-17: Block index kept in a header, per-thread free lists
+ * 
+ **/
+
+#include "slabPool.h"
+#include <new>
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+// Pools created so far, used to number them
+static std::atomic<unsigned int> poolCount(0);
+
+/**
+ * ThreadFreeLists Struct
+ * Description:
+ *          Free lists of one thread, one per pool by pool id. Blocks still
+ *          held when the thread ends go back to their pool.
+ **/
+struct ThreadFreeLists
+{
+    std::vector<SlabPool*> pools;
+    std::vector<std::vector<char*>> lists;
+
+    ~ThreadFreeLists()
+    {
+        for (int i=0; i<lists.size(); ++i)
+        {
+            if (pools[i] != NULL && !lists[i].empty())
+            {
+                pools[i]->flush(lists[i], lists[i].size());
+            }
+        }
+    }
+};
+
+static thread_local ThreadFreeLists threadFreeLists;
+
+// Constructor
+SlabPool::SlabPool(std::size_t size, bool huge)
+    {
+        std::size_t align = alignof(std::max_align_t);
+        id = poolCount++;
+        blockSize = (size + align - 1) / align * align;
+        headerSize = (sizeof(unsigned int) + align - 1) / align * align;
+        stride = headerSize + blockSize;
+        blocksPerSlab = SLAB_OBJECTS;
+        slabBytes = stride * blocksPerSlab;
+        hugePages = false;
+        setHugePages(huge);
+        allocations = 0;
+        releases = 0;
+        live = 0;
+        peak = 0;
+        stats = {0, 0, 0, 0, 0, 0, 0};
+    }
+
+// Destructor
+SlabPool::~SlabPool()
+{
+    for (int i=0; i<slabs.size(); ++i)
+    {
+#ifdef __linux__
+        if (slabMapped[i])
+        {
+            munmap(slabs[i], slabBytes);
+            continue;
+        }
+#endif
+        ::operator delete(slabs[i]);
+    }
+}
+
+/**
+ * setHugePages
+ * Inputs:
+ *      bool - Whether slabs should be backed by huge pages
+ * Outputs:
+ *      bool - False if slabs were already reserved and nothing changed
+ * Description:
+ *          Chooses the page backing. Huge page slabs hold as many blocks
+ *          as fit in SLAB_HUGE_BYTES. Only possible before the first
+ *          allocation, since the slab size fixes every block's index.
+ **/
+bool SlabPool::setHugePages(bool enable)
+{
+    std::lock_guard<std::mutex> lock(protectPool);
+    if (!slabs.empty())
+    {
+        return false;
+    }
+    hugePages = enable;
+    blocksPerSlab = hugePages ? SLAB_HUGE_BYTES / stride : SLAB_OBJECTS;
+    slabBytes = hugePages ? SLAB_HUGE_BYTES : stride * blocksPerSlab;
+    return true;
+}
+
+/**
+ * addSlab
+ * Inputs: None
+ * Outputs: None
+ * Description:
+ *          Reserves one more slab, writes each block's index into its
+ *          header and puts the blocks on the shared free list. With huge
+ *          pages, explicit huge pages are tried first, then normal pages
+ *          marked for transparent huge pages. Caller must hold protectPool.
+ **/
+void SlabPool::addSlab()
+{
+    char* slab = NULL;
+    bool mapped = false;
+#ifdef __linux__
+    if (hugePages)
+    {
+        void* memory = mmap(NULL, slabBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (memory != MAP_FAILED)
+        {
+            stats.hugeSlabs++;
+        }
+        else
+        {
+            memory = mmap(NULL, slabBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (memory != MAP_FAILED)
+            {
+                madvise(memory, slabBytes, MADV_HUGEPAGE);
+            }
+        }
+        if (memory != MAP_FAILED)
+        {
+            slab = (char*)memory;
+            mapped = true;
+        }
+    }
+#endif
+    if (slab == NULL)
+    {
+        slab = (char*)::operator new(slabBytes);
+    }
+    slabs.push_back(slab);
+    slabMapped.push_back(mapped);
+    stats.slabs++;
+    stats.bytesReserved += slabBytes;
+
+    // Lowest index ends up on top so blocks are handed out in order
+    unsigned int firstIndex = (slabs.size() - 1) * blocksPerSlab;
+    freeList.reserve(freeList.size() + blocksPerSlab);
+    for (unsigned int i=blocksPerSlab; i>0; --i)
+    {
+        char* header = slab + (std::size_t)(i - 1) * stride;
+        *(unsigned int*)header = firstIndex + i - 1;
+        freeList.push_back(header);
+    }
+}
+
+/**
+ * localFreeList
+ * Inputs: None
+ * Outputs:
+ *      std::vector<char*>& - The calling thread's free list for this pool
+ * Description:
+ *          Finds the thread's free list by pool id, making room on first use
+ **/
+std::vector<char*>& SlabPool::localFreeList()
+{
+    if (threadFreeLists.lists.size() <= id)
+    {
+        threadFreeLists.lists.resize(id + 1);
+        threadFreeLists.pools.resize(id + 1, NULL);
+    }
+    threadFreeLists.pools[id] = this;
+    return threadFreeLists.lists[id];
+}
+
+/**
+ * refill
+ * Inputs:
+ *      std::vector<char*>& - Empty free list of the calling thread
+ * Outputs: None
+ * Description:
+ *          Moves up to POOL_THREAD_BATCH blocks from the top of the shared
+ *          free list, reserving a slab if it is empty. Order is kept, so
+ *          one thread sees the same blocks as with a single shared list.
+ **/
+void SlabPool::refill(std::vector<char*>& local)
+{
+    std::lock_guard<std::mutex> lock(protectPool);
+    if (freeList.empty())
+    {
+        addSlab();
+    }
+    std::size_t count = freeList.size() < POOL_THREAD_BATCH ? freeList.size() : POOL_THREAD_BATCH;
+    local.insert(local.end(), freeList.end() - count, freeList.end());
+    freeList.resize(freeList.size() - count);
+}
+
+/**
+ * flush
+ * Inputs:
+ *      std::vector<char*>& - Free list of the calling thread
+ *      std::size_t - Number of blocks to give back
+ * Outputs: None
+ * Description:
+ *          Moves the oldest blocks of the thread's list onto the top of
+ *          the shared free list, keeping their order
+ **/
+void SlabPool::flush(std::vector<char*>& local, std::size_t count)
+{
+    std::lock_guard<std::mutex> lock(protectPool);
+    freeList.insert(freeList.end(), local.begin(), local.begin() + count);
+    local.erase(local.begin(), local.begin() + count);
+}
+
+/**
+ * allocate
+ * Inputs: None
+ * Outputs:
+ *      void* - Uninitialized block of at least the pool's size
+ * Description:
+ *          Takes a block off the thread's free list, refilling it from
+ *          the shared list when empty. Only the refill takes the lock.
+ **/
+void* SlabPool::allocate()
+{
+    std::vector<char*>& local = localFreeList();
+    if (local.empty())
+    {
+        refill(local);
+    }
+    char* header = local.back();
+    local.pop_back();
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    unsigned long int count = live.fetch_add(1, std::memory_order_relaxed) + 1;
+    unsigned long int highest = peak.load(std::memory_order_relaxed);
+    while (count > highest && !peak.compare_exchange_weak(highest, count, std::memory_order_relaxed))
+    {
+    }
+    return header + headerSize;
+}
+
+/**
+ * release
+ * Inputs:
+ *      void* - Block from allocate, already destroyed
+ * Outputs: None
+ * Description:
+ *          Puts the block on the thread's free list. Once the list holds
+ *          two batches, the oldest batch goes back to the shared list.
+ **/
+void SlabPool::release(void* block)
+{
+    if (block == NULL)
+    {
+        return;
+    }
+    std::vector<char*>& local = localFreeList();
+    local.push_back((char*)block - headerSize);
+    if (local.size() >= 2 * POOL_THREAD_BATCH)
+    {
+        flush(local, POOL_THREAD_BATCH);
+    }
+    releases.fetch_add(1, std::memory_order_relaxed);
+    live.fetch_sub(1, std::memory_order_relaxed);
+}
+
+/**
+ * indexOf
+ * Inputs:
+ *      void* - Block from allocate
+ * Outputs:
+ *      unsigned int - Index of the block, stable while it is allocated
+ * Description:
+ *          Reads the index from the block's header
+ **/
+unsigned int SlabPool::indexOf(void* block)
+{
+    return *(unsigned int*)((char*)block - headerSize);
+}
+
+/**
+ * at
+ * Inputs:
+ *      unsigned int - Index of a block
+ * Outputs:
+ *      void* - Pointer to the block, NULL if the index was never reserved
+ * Description:
+ *          Turns an index from indexOf back into a pointer
+ **/
+void* SlabPool::at(unsigned int index)
+{
+    std::lock_guard<std::mutex> lock(protectPool);
+    if (index / blocksPerSlab >= slabs.size())
+    {
+        return NULL;
+    }
+    return slabs[index / blocksPerSlab] + (std::size_t)(index % blocksPerSlab) * stride + headerSize;
+}
+
+/**
+ * getStats
+ * Inputs: None
+ * Outputs:
+ *      PoolStats - Copy of the pool's allocation statistics
+ * Description:
+ *          Reads the counters and, under the pool mutex, the slab totals
+ **/
+PoolStats SlabPool::getStats()
+{
+    std::lock_guard<std::mutex> lock(protectPool);
+    PoolStats copy = stats;
+    copy.allocations = allocations.load(std::memory_order_relaxed);
+    copy.releases = releases.load(std::memory_order_relaxed);
+    copy.live = live.load(std::memory_order_relaxed);
+    copy.peak = peak.load(std::memory_order_relaxed);
+    return copy;
+}
\ No newline at end of file
@@ -0,0 +1,125 @@
+/**
+ * Slab Pool
+ * 
+ * Authors: Marcus Chan, Raymond Jia
+ * Class: ECE 4122 - Hurley
+ * Final Project - Autonomous Traffic Simulator
+ * 
+ * Description:
+ *      Fixed size object pool backing Pod and Vehicle allocation. Memory is
+ *      reserved a slab at a time and never returned while the pool lives;
+ *      freed objects go on a free list and are handed out again, so a long
+ *      run reaches a steady state with no heap traffic. Every object keeps
+ *      the same index for as long as it is allocated. Slabs can optionally
+ *      be backed by huge pages. Each thread keeps its own free list and
+ *      only takes the pool lock to trade a batch of blocks with the shared
+ *      list, so controllers on different threads rarely contend.
+ * 
+ * Revision History:
+ *      17OCT2026  R-10-17: Document Created, initial coding
+ *      17OCT2026  R-10-17: Block index kept in a header, per-thread free lists
+ * 
+ **/
+
+#ifndef SLABPOOL_H
+#define SLABPOOL_H
+
+#include <cstddef>
+#include <vector>
+#include <mutex>
+#include <atomic>
+
+// Objects per slab with normal pages
+#define SLAB_OBJECTS 512
+
+// Bytes per slab with huge pages
+#define SLAB_HUGE_BYTES (2*1024*1024)
+
+// Default page backing of new pools
+#define POOL_HUGE_PAGES 0
+
+// Blocks a thread takes from or gives back to the shared free list at once
+#define POOL_THREAD_BATCH 64
+
+/**
+ * PoolStats Struct
+ * Description:
+ *          Data structure for pool allocation statistics
+ * Contains:
+ *      unsigned long int allocations - Objects handed out
+ *      unsigned long int releases - Objects given back
+ *      unsigned long int live - Objects currently handed out
+ *      unsigned long int peak - Highest live count
+ *      unsigned long int slabs - Slabs reserved
+ *      unsigned long int hugeSlabs - Slabs backed by huge pages
+ *      unsigned long int bytesReserved - Bytes held by all slabs
+ **/
+struct PoolStats
+{
+    unsigned long int allocations;
+    unsigned long int releases;
+    unsigned long int live;
+    unsigned long int peak;
+    unsigned long int slabs;
+    unsigned long int hugeSlabs;
+    unsigned long int bytesReserved;
+};
+
+/**
+ * SlabPool Class
+ * Description:
+ *          Thread safe pool of equally sized blocks. Blocks are numbered
+ *          slab by slab, and the most recently freed block is reused first.
+ *          Every block is preceded by a header holding its index. A pool
+ *          must outlive the threads that allocate from it.
+ **/
+class SlabPool
+{
+public:
+    // Constructors
+    SlabPool(std::size_t size, bool huge = POOL_HUGE_PAGES);
+
+    // Destructors
+    ~SlabPool();
+
+    // Member Functions
+    void* allocate();
+    void release(void* block);
+    unsigned int indexOf(void* block);
+    void* at(unsigned int index);
+
+    // Setters
+    bool setHugePages(bool enable);
+
+    // Getters
+    std::size_t getBlockSize(){return blockSize;}
+    bool getHugePages(){return hugePages;}
+    PoolStats getStats();
+
+private:
+    friend struct ThreadFreeLists;
+
+    void addSlab();
+    std::vector<char*>& localFreeList();
+    void refill(std::vector<char*>& local);
+    void flush(std::vector<char*>& local, std::size_t count);
+
+    std::mutex protectPool;                 // Mutex for the shared free list and the slabs
+    unsigned int id;                        // Position of the pool in every thread's free lists
+    std::size_t blockSize;                  // Object size rounded up for alignment
+    std::size_t headerSize;                 // Bytes before each block holding its index
+    std::size_t stride;                     // Distance between blocks, header included
+    unsigned int blocksPerSlab;             // Blocks in every slab
+    std::size_t slabBytes;                  // Bytes in every slab
+    bool hugePages;                         // Whether new slabs ask for huge pages
+    std::vector<char*> slabs;               // Start of every slab in index order
+    std::vector<bool> slabMapped;           // Whether the slab came from mmap
+    std::vector<char*> freeList;            // Headers of free blocks not held by a thread
+    std::atomic<unsigned long int> allocations;     // Objects handed out
+    std::atomic<unsigned long int> releases;        // Objects given back
+    std::atomic<unsigned long int> live;            // Objects currently handed out
+    std::atomic<unsigned long int> peak;            // Highest live count
+    PoolStats stats;                        // Slab statistics, under protectPool
+};
+
+#endif
\ No newline at end of file
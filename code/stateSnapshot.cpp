@@ -0,0 +1,148 @@
+/**
+ * State Snapshot
+ * 
+ * Authors: Marcus Chan, Raymond Jia
+ * Class: ECE 4122 - Hurley
+ * Final Project - Autonomous Traffic Simulator
+ * 
+ * Description:
+ *      Function implementation for StateSnapshot class
+ * 
+ * Revision History:
+ *      17OCT2026  R-10-17: Document Created, initial coding
+ *      17OCT2026  R-10-17: Published straight from the PodStore arrays
+ *      17OCT2026  R-10-17: Positions converted from fixed point
+ * 
+ **/
+
+#include "stateSnapshot.h"
+
+// Slots allocated for the first block
+#define SNAPSHOT_INITIAL_CAPACITY 64
+
+// Constructor
+StateSnapshot::StateSnapshot()
+    {
+        SnapshotBlock* firstBlock = new SnapshotBlock;
+        firstBlock->capacity = SNAPSHOT_INITIAL_CAPACITY;
+        firstBlock->slots = new SnapshotSlot[SNAPSHOT_INITIAL_CAPACITY];
+        blocks.push_back(firstBlock);
+        block.store(firstBlock, std::memory_order_relaxed);
+        sequence.store(0, std::memory_order_relaxed);
+        podCount.store(0, std::memory_order_relaxed);
+        snapshotTime.store(0, std::memory_order_relaxed);
+        snapshotProcessed.store(0, std::memory_order_relaxed);
+        snapshotWait.store(0, std::memory_order_relaxed);
+    }
+
+// Destructor
+StateSnapshot::~StateSnapshot()
+{
+    for (int i=0; i<blocks.size(); ++i)
+    {
+        delete[] blocks[i]->slots;
+        delete blocks[i];
+    }
+    blocks.clear();
+}
+
+/**
+ * publish
+ * Inputs:
+ *      unsigned long int - Tick the snapshot shows
+ *      unsigned long int - Vehicles processed so far
+ *      double - Total wait of processed vehicles
+ *      PodStore& - Controlled pods, empty slots are skipped
+ * Outputs: None
+ * Description:
+ *          Writes a new snapshot. Only one thread may publish.
+ **/
+void StateSnapshot::publish(unsigned long int time, unsigned long int processed, double wait, PodStore& pods)
+{
+    // Grow before opening the write so readers spin for as short as possible
+    SnapshotBlock* thisBlock = block.load(std::memory_order_relaxed);
+    if (pods.size() > thisBlock->capacity)
+    {
+        SnapshotBlock* newBlock = new SnapshotBlock;
+        newBlock->capacity = thisBlock->capacity;
+        while (newBlock->capacity < pods.size())
+        {
+            newBlock->capacity *= 2;
+        }
+        newBlock->slots = new SnapshotSlot[newBlock->capacity];
+        blocks.push_back(newBlock);
+        thisBlock = newBlock;
+    }
+
+    // Odd sequence marks the write in progress
+    unsigned long int seq = sequence.load(std::memory_order_relaxed);
+    sequence.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    block.store(thisBlock, std::memory_order_relaxed);
+    unsigned long int count = 0;
+    for (int i=0; i<pods.size(); ++i)
+    {
+        if (pods[i] == NULL)
+        {
+            continue;
+        }
+        thisBlock->slots[count].vehicle.store(pods[i]->getVehicle(), std::memory_order_relaxed);
+        thisBlock->slots[count].lane.store(pods.lanes[pods.laneIndex[i]].lane, std::memory_order_relaxed);
+        thisBlock->slots[count].position.store(PodStore::toUnits(pods.position[i]), std::memory_order_relaxed);
+        count++;
+    }
+    podCount.store(count, std::memory_order_relaxed);
+    snapshotTime.store(time, std::memory_order_relaxed);
+    snapshotProcessed.store(processed, std::memory_order_relaxed);
+    snapshotWait.store(wait, std::memory_order_relaxed);
+
+    sequence.store(seq + 2, std::memory_order_release);
+}
+
+/**
+ * read
+ * Inputs:
+ *      Snapshot& - Filled with a consistent copy of the last snapshot
+ * Outputs: None
+ * Description:
+ *          Copies the snapshot without taking a lock, retrying if a
+ *          publish started or finished during the copy
+ **/
+void StateSnapshot::read(Snapshot& snapshot)
+{
+    while (true)
+    {
+        unsigned long int seq = sequence.load(std::memory_order_acquire);
+        if (seq & 1)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        SnapshotBlock* thisBlock = block.load(std::memory_order_relaxed);
+        unsigned long int count = podCount.load(std::memory_order_relaxed);
+        if (count > thisBlock->capacity)
+        {
+            // Torn read of a growing snapshot, sequence check below fails
+            count = thisBlock->capacity;
+        }
+        snapshot.pods.resize(count);
+        for (unsigned long int i=0; i<count; ++i)
+        {
+            snapshot.pods[i].vehicle = thisBlock->slots[i].vehicle.load(std::memory_order_relaxed);
+            snapshot.pods[i].lane = thisBlock->slots[i].lane.load(std::memory_order_relaxed);
+            snapshot.pods[i].position = thisBlock->slots[i].position.load(std::memory_order_relaxed);
+        }
+        snapshot.time = snapshotTime.load(std::memory_order_relaxed);
+        snapshot.vehiclesProcessed = snapshotProcessed.load(std::memory_order_relaxed);
+        snapshot.totalWait = snapshotWait.load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (sequence.load(std::memory_order_relaxed) == seq)
+        {
+            snapshot.version = seq / 2;
+            return;
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,122 @@
+/**
+ * State Snapshot
+ * 
+ * Authors: Marcus Chan, Raymond Jia
+ * Class: ECE 4122 - Hurley
+ * Final Project - Autonomous Traffic Simulator
+ * 
+ * Description:
+ *      Versioned snapshot of the simulation published once per tick.
+ *      One writer publishes under a sequence lock, any number of readers
+ *      copy it out without blocking the writer. A reader that overlaps a
+ *      publish notices the sequence change and copies again.
+ * 
+ * Revision History:
+ *      17OCT2026  R-10-17: Document Created, initial coding
+ *      17OCT2026  R-10-17: Published straight from the PodStore arrays
+ * 
+ **/
+
+#ifndef STATESNAPSHOT_H
+#define STATESNAPSHOT_H
+
+#include <atomic>
+#include <vector>
+#include <thread>
+
+#include "pod.h"
+
+/**
+ * PodState Struct
+ * Description:
+ *          Data structure for the published state of one pod
+ * Contains:
+ *      Vehicle* vehicle - Pointer to the vehicle the pod controls
+ *      Lane* lane - Pointer to the lane the pod is in
+ *      double position - Linear position in lane
+ **/
+struct PodState
+{
+    Vehicle* vehicle;
+    Lane* lane;
+    double position;
+};
+
+/**
+ * Snapshot Struct
+ * Description:
+ *          Data structure a reader copies the snapshot into
+ * Contains:
+ *      unsigned long int version - Number of publishes so far
+ *      unsigned long int time - Tick the snapshot shows
+ *      unsigned long int vehiclesProcessed - Vehicles that have left control
+ *      double totalWait - Sum of wait times of processed vehicles
+ *      std::vector<PodState> pods - State of every controlled pod
+ **/
+struct Snapshot
+{
+    unsigned long int version;
+    unsigned long int time;
+    unsigned long int vehiclesProcessed;
+    double totalWait;
+    std::vector<PodState> pods;
+};
+
+/**
+ * SnapshotSlot Struct
+ * Description:
+ *          Data structure for one published pod. Fields are relaxed atomics
+ *          so readers racing the writer are well defined.
+ **/
+struct SnapshotSlot
+{
+    std::atomic<Vehicle*> vehicle;
+    std::atomic<Lane*> lane;
+    std::atomic<double> position;
+};
+
+/**
+ * SnapshotBlock Struct
+ * Description:
+ *          Data structure for an array of slots along with its size
+ **/
+struct SnapshotBlock
+{
+    unsigned long int capacity;
+    SnapshotSlot* slots;
+};
+
+/**
+ * StateSnapshot Class
+ * Description:
+ *          Class that holds the published snapshot. When the pods outgrow
+ *          the slots a bigger block is swapped in; old blocks are kept
+ *          until destruction since a late reader may still be copying them.
+ **/
+class StateSnapshot
+{
+public:
+    // Constructors
+    StateSnapshot();
+
+    // Destructors
+    ~StateSnapshot();
+
+    // Member Functions
+    void publish(unsigned long int time, unsigned long int processed, double wait, PodStore& pods);
+    void read(Snapshot& snapshot);
+
+    // Getters
+    unsigned long int getVersion(){return sequence.load(std::memory_order_acquire) / 2;}
+
+private:
+    std::atomic<unsigned long int> sequence;    // Odd while a publish is in progress
+    std::atomic<SnapshotBlock*> block;          // Current block of slots
+    std::atomic<unsigned long int> podCount;    // Slots in use
+    std::atomic<unsigned long int> snapshotTime;            // Tick of the snapshot
+    std::atomic<unsigned long int> snapshotProcessed;       // Vehicles processed at that tick
+    std::atomic<double> snapshotWait;                       // Total wait at that tick
+    std::vector<SnapshotBlock*> blocks;         // Every block ever allocated, freed on destruction
+};
+
+#endif
\ No newline at end of file
@@ -13,10 +13,19 @@
  *      04DEC2021  R-12-04: Re-write following TrafficController
  *                          class update.
  *      07DEC2021  R-12-07: Debugging and code cleanup
+ *      17OCT2026  R-10-17: Split update into per pod hooks
+ *      17OCT2026  R-10-17: Update pass works on PodStore arrays
+ *      17OCT2026  R-10-17: Lane lookups by node index
+ *      17OCT2026  R-10-17: Queue positions derived from lane queue sequence numbers
+ *      17OCT2026  R-10-17: Queue membership checked by pod pointer
+ *      17OCT2026  R-10-17: Per phase steps run over phase buckets
+ *      17OCT2026  R-10-17: Kinematics in fixed point
+ *      17OCT2026  R-10-17: Approach brakes within the vehicle's deceleration
  * 
  **/
 
 #include "stopTrafficController.h"
+#include <cmath>
 
 /**
  * schedulePod
@@ -34,21 +43,11 @@ void StopTrafficController::schedulePod(Vehicle* entryVehicle)
     entryVehicle->setTrafficControl(true);
     
     // Create a pod
-    std::string lane_id = entryVehicle->getSource()->nodeID + "-" + entryVehicle->getDestination()->nodeID;
-    Lane* desiredLane = thisIntersection->getLane(lane_id);
-    std::string src_node_id = desiredLane->getSource()->nodeID;
-    Pod* entryPod = new Pod(entryVehicle, desiredLane, globalTime);
-
-    // Add to controlled pods
-    controlledPods.push_back(entryPod);
+    Lane* desiredLane = thisIntersection->getLane(entryVehicle->getSource(), entryVehicle->getDestination());
+    Pod* entryPod = controlledPods.create(entryVehicle, desiredLane, globalTime);
     
     // Add pod to lane queue
-    std::map<std::string, std::vector<Pod*>>::iterator it = laneQueues.find(src_node_id);
-    it->second.push_back(entryPod);
-    for (int i=0; i<it->second.size(); ++i)
-    {
-        it->second[i]->setPositionInQueue(i);
-    }
+    laneQueues[desiredLane->getSource()->nodeIndex].push(entryPod);
 
     // Add pod to world queue
     worldQueue.push_back(entryPod);
@@ -57,135 +56,285 @@ void StopTrafficController::schedulePod(Vehicle* entryVehicle)
 }
 
 /**
- * doUpdate
- * Inputs: None
- * Outputs: None
+ * hasRoom
+ * Inputs:
+ *      Vehicle* - Pointer to the vehicle at the front of the entryQueue
+ * Outputs:
+ *      bool - True if the vehicle can stop at its place in the lane queue
  * Description:
- *          Loops through all controlled pods and updates their position
- *          Uses OpenMP to speed up the update process
+ *          With acceleration limits on, a vehicle braking from its current
+ *          speed may not stop in time for a place near the back of a long
+ *          queue, so it is held back until the queue moves up
  **/
-void StopTrafficController::doUpdate()
+bool StopTrafficController::hasRoom(Vehicle* entryVehicle)
 {
-    if (DEBUG) {std::cout << "Entered doUpdate\n";}
-
-    // Prepare post multithreading update flags
-    bool popWorld = false;
-    bool leaveControl = false;
-    std::vector<std::string> popLane;
-
-    // Begin parallel computing for update
-    int i, N, tid;
-    N = controlledPods.size();
-
-#pragma omp parallel shared(i, N) private(tid)
+    if (!controlledPods.isAccelerationLimited())
     {
-        tid = omp_get_thread_num();
+        return true;
+    }
+    Lane* desiredLane = thisIntersection->getLane(entryVehicle->getSource(), entryVehicle->getDestination());
+    LaneQueue& thisLaneQueue = laneQueues[desiredLane->getSource()->nodeIndex];
+    long long int stopFixed = PodStore::toFixed(desiredLane->getBeginIntersection()) - PodStore::toFixed(thisLaneQueue.size());
+    int speed = PodStore::roundFixed(entryVehicle->getCurrentSpeed());
+    // Slowing from the first tick on covers the braking distance less the first move at full speed
+    return stopFixed >= PodStore::brakingDistance(speed, PodStore::roundFixed(entryVehicle->getDeceleration())) - speed;
+}
 
-#pragma omp for schedule(dynamic)
-        for (i=0; i<N; ++i)
-        {
-            Pod* thisPod = controlledPods[i];
+/**
+ * stepPod
+ * Inputs:
+ *      unsigned int - Slot of the pod being updated
+ *      UpdateSignals& - Signals for the post update
+ * Outputs:
+ *      bool - True if the pod has left intersection control
+ * Description:
+ *          Updates the position of a single pod for one tick
+ *          with the step of its phase. Used by the event engine.
+ **/
+bool StopTrafficController::stepPod(unsigned int slot, UpdateSignals& signals)
+{
+    if (DEBUG) {std::cout << controlledPods[slot]->getPodID() << " : " << controlledPods.getBounds(slot).lane->getLaneID() << " : " << controlledPods[slot]->getPosition() << std::endl;}
 
-            if (DEBUG) {std::cout << thisPod->getPodID() << " : " << thisPod->getLane()->getLaneID() << " : " << thisPod->getPosition() << std::endl;}
+    switch (controlledPods.phase[slot])
+    {
+        case POD_APPROACHING:
+            approachPod(slot);
+            return false;
+        case POD_WAITING:
+            waitPod(slot, signals);
+            return false;
+        case POD_INSIDE:
+            crossPod(slot, signals);
+            return false;
+        case POD_EXITING:
+            controlledPods.updatePosition(slot, controlledPods.getBounds(slot).exitFixed);
+            return false;
+        default:
+            departPod(slot, signals);
+            return true;
+    }
+}
 
-            // Check if pod has left intersection control
-            if (thisPod->getPosition() > thisPod->getLane()->getLaneLength())
-            {
-                // Get rid of this pod
-                controlledPods[i] = NULL;
-                thisPod->setExitStamp(globalTime);
-                delete thisPod;
-                leaveControl = true;
-            }
-            // Check if pod is beyond intersection but has not left yet
-            else if (thisPod->getPosition() > thisPod->getLane()->getEndIntersection())
+/**
+ * stepBucket
+ * Inputs:
+ *      unsigned int - Phase of the bucket
+ *      UpdateSignals& - Signals for the post update
+ * Outputs: None
+ * Description:
+ *          Runs the step of the bucket's phase over all of its pods.
+ *          Called by every thread of the update, the pods of the
+ *          bucket are shared out among them.
+ **/
+void StopTrafficController::stepBucket(unsigned int podPhase, UpdateSignals& signals)
+{
+    std::vector<unsigned int>& bucket = controlledPods.getBucket(podPhase);
+    int N = bucket.size();
+    switch (podPhase)
+    {
+        case POD_APPROACHING:
+#pragma omp for schedule(static) nowait
+            for (int k=0; k<N; ++k)
             {
-                thisPod->updatePosition(thisPod->getLane()->getDestination()->speedLimit);
+                approachPod(bucket[k]);
             }
-            // Check if pod is in intersection
-            else if (thisPod->getPosition() > thisPod->getLane()->getBeginIntersection())
+            break;
+        case POD_WAITING:
+#pragma omp for schedule(static) nowait
+            for (int k=0; k<N; ++k)
             {
-                // Leaving intersection, signal removal from world queue
-                if (thisPod->getPosition() + thisPod->getLane()->getDestination()->speedLimit > thisPod->getLane()->getEndIntersection())
-                {
-                    popWorld = true;
-                }
-                thisPod->updatePosition(thisPod->getLane()->getDestination()->speedLimit);
+                waitPod(bucket[k], signals);
             }
-            // Check if pod is stopped at intersection
-            else if (thisPod->getPosition() == thisPod->getLane()->getBeginIntersection())
+            break;
+        case POD_INSIDE:
+#pragma omp for schedule(static) nowait
+            for (int k=0; k<N; ++k)
             {
-                // Check stop timer
-                if (thisPod->getCountdown() > 0)
-                {                    
-                    thisPod->updatePosition(0);
-                }
-                else if (thisPod->getCountdown() == 0)
-                {
-                    // Check if first in world queue, if so, go time!
-                    if (worldQueue.front()->getPodID() == thisPod->getPodID())
-                    {
-                        // Signal removal from lane queue
-                        std::map<std::string, std::vector<Pod*>>::iterator laneIt = laneQueues.find(thisPod->getLane()->getSource()->nodeID);
-                        popLane.push_back(thisPod->getLane()->getSource()->nodeID);
-                        thisPod->updatePosition(thisPod->getLane()->getDestination()->speedLimit);                        
-                    }
-                    else
-                    {
-                        thisPod->updatePosition(0);
-                    }
-                }
-                else
-                {
-                    if (DEBUG) {std::cout << "Stop!\n";}
-                    thisPod->updatePosition(0,3);
-                }
+                crossPod(bucket[k], signals);
             }
-            // Check if pod is right before stop target in queue
-            else if (thisPod->getPosition() + thisPod->getLane()->getSource()->speedLimit > thisPod->getLane()->getBeginIntersection() - thisPod->getPositionInQueue())
+            break;
+        case POD_EXITING:
+#pragma omp for schedule(static) nowait
+            for (int k=0; k<N; ++k)
             {
-                thisPod->updatePosition(thisPod->getLane()->getBeginIntersection() - thisPod->getPositionInQueue() - thisPod->getPosition());
+                controlledPods.updatePosition(bucket[k], controlledPods.getBounds(bucket[k]).exitFixed);
             }
-            // Pod is approaching intersection
-            else
+            break;
+        default:
+#pragma omp for schedule(static) nowait
+            for (int k=0; k<N; ++k)
             {
-                thisPod->updatePosition(thisPod->getLane()->getSource()->speedLimit);
+                departPod(bucket[k], signals);
+                controlledPods[bucket[k]] = NULL;
             }
-        }
+            break;
     }
+}
 
-    // Signal received to pop the world queue
-    if (popWorld)
+/**
+ * approachPod
+ * Inputs:
+ *      unsigned int - Slot of a pod before the intersection
+ * Outputs: None
+ * Description:
+ *          Drives at the speed limit, stopping exactly at the pod's
+ *          place in its lane queue. Slows down to its stopping speed
+ *          early enough to stop there with its deceleration.
+ **/
+void StopTrafficController::approachPod(unsigned int slot)
+{
+    LaneBounds& bounds = controlledPods.getBounds(slot);
+    long long int position = controlledPods.position[slot];
+    int positionInQueue = controlledPods[slot]->getPositionInQueue();
+    // Stop target in lane units, unsigned as in the lane bounds
+    unsigned int stopTarget = bounds.beginIntersection - positionInQueue;
+    long long int stopFixed = (long long int)stopTarget * POSITION_ONE;
+    // Slow down once the stop target is within braking distance
+    int speed = bounds.approachFixed;
+    if (stopFixed - position < controlledPods.stoppingDistance(slot, speed))
     {
-        worldQueue.erase(worldQueue.begin());
+        speed = controlledPods.stoppingSpeed(slot, (int)(stopFixed - position));
     }
+    controlledPods.updatePosition(slot, speed);
+}
 
-    // Signal received that a pod left control
-    if (leaveControl)
+/**
+ * waitPod
+ * Inputs:
+ *      unsigned int - Slot of a pod stopped at the intersection
+ *      UpdateSignals& - Signals for the post update
+ * Outputs: None
+ * Description:
+ *          Starts the stop timer on arrival and holds the pod until the
+ *          timer is done and the pod is first in the world queue
+ **/
+void StopTrafficController::waitPod(unsigned int slot, UpdateSignals& signals)
+{
+    LaneBounds& bounds = controlledPods.getBounds(slot);
+    // Check stop timer
+    if (controlledPods.countdown[slot] > 0)
     {
-        for (int i=0; i<controlledPods.size(); ++i)
+        controlledPods.updatePosition(slot, 0);
+    }
+    else if (controlledPods.countdown[slot] == 0)
+    {
+        // Check if first in world queue, if so, go time!
+        if (worldQueue.front() == controlledPods[slot])
         {
-            if (controlledPods[i] == NULL)
-            {
-                controlledPods.erase(controlledPods.begin() + i);
-                i--;
-            }
+            // Signal removal from lane queue
+#pragma omp critical
+            signals.popLane.push_back(bounds.sourceIndex);
+            controlledPods.updatePosition(slot, bounds.exitFixed);
+        }
+        else
+        {
+            controlledPods.updatePosition(slot, 0);
         }
     }
+    else
+    {
+        if (DEBUG) {std::cout << "Stop!\n";}
+        controlledPods.updatePosition(slot, 0, 3);
+    }
+}
 
-    // Signal received to pop a lane queue
-    if (!popLane.empty())
+/**
+ * crossPod
+ * Inputs:
+ *      unsigned int - Slot of a pod in the intersection
+ *      UpdateSignals& - Signals for the post update
+ * Outputs: None
+ * Description:
+ *          Signals removal from the world queue as the pod is leaving
+ *          the intersection and drives at the exit speed limit, or as
+ *          close to it as the pod's limits allow
+ **/
+void StopTrafficController::crossPod(unsigned int slot, UpdateSignals& signals)
+{
+    LaneBounds& bounds = controlledPods.getBounds(slot);
+    if (controlledPods.position[slot] + controlledPods.limitedSpeed(slot, bounds.exitFixed) > bounds.endFixed)
     {
-        for (int i=0; i<popLane.size(); ++i)
+        signals.popWorld = true;
+    }
+    controlledPods.updatePosition(slot, bounds.exitFixed);
+}
+
+/**
+ * quietTicks
+ * Inputs:
+ *      Pod* - Pointer to the pod
+ *      int& - Set to the speed the pod holds meanwhile
+ * Outputs:
+ *      unsigned long int - Number of upcoming ticks where the pod only
+ *                          moves at a fixed speed without affecting queues
+ * Description:
+ *          Used by the event engine. Pods waiting in a queue or behind the
+ *          stop sign stay quiet until a queue changes, which makes the
+ *          event engine re-plan every pod.
+ **/
+unsigned long int StopTrafficController::quietTicks(Pod* thePod, int& speed)
+{
+    Lane* thisLane = thePod->getLane();
+    double position = thePod->getPosition();
+    int speedIn = thisLane->getSource()->speedLimit;
+    int speedOut = thisLane->getDestination()->speedLimit;
+
+    // Leaving intersection control
+    if (position > thisLane->getLaneLength())
+    {
+        return 0;
+    }
+    // Beyond intersection, quiet until the end of the lane
+    if (position > thisLane->getEndIntersection())
+    {
+        speed = speedOut;
+        return speedOut > 0 ? (unsigned long int)((thisLane->getLaneLength() - position) / speedOut) + 1 : ULONG_MAX;
+    }
+    // In intersection, quiet until the step that leaves it
+    if (position > thisLane->getBeginIntersection())
+    {
+        speed = speedOut;
+        if (speedOut <= 0)
         {
-            laneQueues.find(popLane[i])->second.erase(laneQueues.find(popLane[i])->second.begin());
-            // Update queue positions
-            for (int j=0; j<laneQueues.find(popLane[i])->second.size(); ++j)
-            {
-                laneQueues.find(popLane[i])->second[j]->setPositionInQueue(j);
-            }
+            return ULONG_MAX;
         }
+        double room = thisLane->getEndIntersection() - speedOut - position;
+        return room < 0 ? 0 : (unsigned long int)(room / speedOut) + 1;
     }
-
-    if (DEBUG) {std::cout << "Exited doUpdate\n";}
+    // Stopped at intersection
+    if (position == thisLane->getBeginIntersection())
+    {
+        speed = 0;
+        if (thePod->getCountdown() > 0)
+        {
+            return thePod->getCountdown();
+        }
+        // Waiting for our turn
+        if (thePod->getCountdown() == 0 && !worldQueue.empty() && worldQueue.front() != thePod)
+        {
+            return ULONG_MAX;
+        }
+        return 0;
+    }
+    // Waiting in queue behind stop target
+    double stopTarget = thisLane->getBeginIntersection() - thePod->getPositionInQueue();
+    if (position + speedIn > stopTarget)
+    {
+        speed = 0;
+        return stopTarget - position > 0 ? 0 : ULONG_MAX;
+    }
+    // Approaching, quiet until the stop target or the intersection is within braking distance
+    speed = speedIn;
+    if (speedIn <= 0)
+    {
+        return ULONG_MAX;
+    }
+    double braking = PodStore::toUnits(controlledPods.stoppingDistance(thePod->getSlot(), PodStore::toFixed(speedIn)));
+    if (position + braking > stopTarget)
+    {
+        return 0;
+    }
+    unsigned long int ticks = (unsigned long int)((stopTarget - braking - position) / speedIn) + 1;
+    unsigned long int toIntersection = (unsigned long int)ceil((thisLane->getBeginIntersection() - position) / speedIn);
+    return ticks < toIntersection ? ticks : toIntersection;
 }
\ No newline at end of file
@@ -16,6 +16,12 @@
  *      04DEC2021  R-12-04: Re-write following TrafficController
  *                          class update.
  *      07DEC2021  R-12-07: Debugging and code cleanup
+ *      17OCT2026  R-10-17: Split update into per pod hooks
+ *      17OCT2026  R-10-17: Join controller threads before destruction
+ *      17OCT2026  R-10-17: Per pod update hook takes a store slot
+ *      17OCT2026  R-10-17: Queue positions no longer rewritten after pops
+ *      17OCT2026  R-10-17: Per phase steps run over phase buckets
+ *      17OCT2026  R-10-17: Vehicles held back until they can brake for their queue place
  * 
  **/
 
@@ -35,9 +41,23 @@ public:
     // Constructors
     StopTrafficController(Intersection* theIntersection, unsigned int tickSpeed):TrafficController(theIntersection, tickSpeed){}
 
+    // Destructors (threads must be joined before derived members go away)
+    ~StopTrafficController(){stopController(); joinController();}
+
     // Member Functions
     void schedulePod(Vehicle* entryVehicle);
-    void doUpdate();
+    bool stepPod(unsigned int slot, UpdateSignals& signals);
+    void stepBucket(unsigned int podPhase, UpdateSignals& signals);
+    unsigned long int quietTicks(Pod* thePod, int& speed);
+    bool supportsEvents(){return true;}
+    bool hasRoom(Vehicle* entryVehicle);
+    bool supportsAccelerationLimits(){return true;}
+
+private:
+    // Per Phase Steps
+    void approachPod(unsigned int slot);
+    void waitPod(unsigned int slot, UpdateSignals& signals);
+    void crossPod(unsigned int slot, UpdateSignals& signals);
 };
 
 #endif
\ No newline at end of file
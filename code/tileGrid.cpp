@@ -0,0 +1,165 @@
+/**
+ * Tile Grid
+ * 
+ * Authors: Marcus Chan, Raymond Jia
+ * Class: ECE 4122 - Hurley
+ * Final Project - Autonomous Traffic Simulator
+ * 
+ * Description:
+ *      Function implementation for TileGrid class
+ * 
+ * Revision History:
+ *      17OCT2026  R-10-17: Document Created, initial coding
+ * 
+ **/
+
+#include "tileGrid.h"
+
+// Constructor
+TileGrid::TileGrid()
+    :slots(TILE_GRID_HORIZON, 0)
+    {
+        mask = TILE_GRID_HORIZON - 1;
+        base = 0;
+    }
+
+/**
+ * fits
+ * Inputs:
+ *      unsigned long int - Entry tick of the crossing
+ *      const std::vector<unsigned long long>& - Tiles swept on each tick of the crossing
+ * Outputs:
+ *      bool - True if none of the tiles are reserved on their tick
+ * Description:
+ *          Probes the grid with one AND per tick
+ **/
+bool TileGrid::fits(unsigned long int start, const std::vector<unsigned long long>& footprint)
+{
+    for (unsigned int k=0; k<footprint.size(); ++k)
+    {
+        if (getTiles(start + k) & footprint[k])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * earliestFit
+ * Inputs:
+ *      unsigned long int - Earliest entry tick allowed
+ *      const std::vector<unsigned long long>& - Tiles swept on each tick of the crossing
+ * Outputs:
+ *      unsigned long int - Earliest entry tick at which the crossing fits
+ * Description:
+ *          Probes every entry tick from the given one on. Ticks past
+ *          the horizon are free, so the search always ends.
+ **/
+unsigned long int TileGrid::earliestFit(unsigned long int from, const std::vector<unsigned long long>& footprint)
+{
+    unsigned long int start = from;
+    while (!fits(start, footprint))
+    {
+        start++;
+    }
+    return start;
+}
+
+/**
+ * reserve
+ * Inputs:
+ *      unsigned long int - Entry tick of the crossing
+ *      const std::vector<unsigned long long>& - Tiles swept on each tick of the crossing
+ * Outputs: None
+ * Description:
+ *          Marks the tiles of the crossing as reserved, growing the
+ *          horizon if the crossing ends beyond it
+ **/
+void TileGrid::reserve(unsigned long int start, const std::vector<unsigned long long>& footprint)
+{
+    if (footprint.empty() || start + footprint.size() <= base)
+    {
+        return;
+    }
+    unsigned long int last = start + footprint.size() - 1;
+    if (last - base > mask)
+    {
+        grow(last);
+    }
+    for (unsigned int k=0; k<footprint.size(); ++k)
+    {
+        if (start + k >= base)
+        {
+            slots[(start + k) & mask] |= footprint[k];
+        }
+    }
+}
+
+/**
+ * advance
+ * Inputs:
+ *      unsigned long int - Current tick
+ * Outputs: None
+ * Description:
+ *          Frees the ticks before the current one so the ring can
+ *          hold later ticks in their place
+ **/
+void TileGrid::advance(unsigned long int time)
+{
+    if (time <= base)
+    {
+        return;
+    }
+    if (time - base > mask)
+    {
+        std::fill(slots.begin(), slots.end(), 0);
+    }
+    else
+    {
+        for (unsigned long int t=base; t<time; ++t)
+        {
+            slots[t & mask] = 0;
+        }
+    }
+    base = time;
+}
+
+/**
+ * clear
+ * Inputs: None
+ * Outputs: None
+ * Description:
+ *          Frees every tick and rewinds the grid to tick 0,
+ *          keeping its horizon
+ **/
+void TileGrid::clear()
+{
+    std::fill(slots.begin(), slots.end(), 0);
+    base = 0;
+}
+
+/**
+ * grow
+ * Inputs:
+ *      unsigned long int - Latest tick the grid must hold
+ * Outputs: None
+ * Description:
+ *          Doubles the horizon until it reaches the tick, moving the
+ *          held ticks to their place in the larger ring
+ **/
+void TileGrid::grow(unsigned long int last)
+{
+    unsigned long int capacity = mask + 1;
+    while (last - base >= capacity)
+    {
+        capacity *= 2;
+    }
+    std::vector<unsigned long long> larger(capacity, 0);
+    for (unsigned long int t=base; t<=base+mask; ++t)
+    {
+        larger[t & (capacity - 1)] = slots[t & mask];
+    }
+    slots.swap(larger);
+    mask = capacity - 1;
+}
\ No newline at end of file
@@ -0,0 +1,63 @@
+/**
+ * Tile Grid
+ * 
+ * Authors: Marcus Chan, Raymond Jia
+ * Class: ECE 4122 - Hurley
+ * Final Project - Autonomous Traffic Simulator
+ * 
+ * Description:
+ *      Space-time reservation grid of an intersection box. Every tick
+ *      holds a 64 bit mask of the box tiles reserved during it, kept in
+ *      a ring indexed by the tick, so a request is checked with one AND
+ *      per tick of its crossing. Ticks that have passed are cleared as
+ *      the grid advances, and the ring doubles when a reservation goes
+ *      beyond its horizon.
+ * 
+ * Revision History:
+ *      17OCT2026  R-10-17: Document Created, initial coding
+ * 
+ **/
+
+#ifndef TILEGRID_H
+#define TILEGRID_H
+
+#include <vector>
+#include <algorithm>
+
+// Starting number of ticks held by a tile grid, grows by doubling
+#define TILE_GRID_HORIZON 1024
+
+/**
+ * TileGrid Class
+ * Description:
+ *          Ring of reserved tile masks by tick. A footprint lists the
+ *          tiles a crossing sweeps on each of its ticks, starting at
+ *          its entry tick.
+ **/
+class TileGrid
+{
+public:
+    // Constructors
+    TileGrid();
+
+    // Member Functions
+    bool fits(unsigned long int start, const std::vector<unsigned long long>& footprint);
+    unsigned long int earliestFit(unsigned long int from, const std::vector<unsigned long long>& footprint);
+    void reserve(unsigned long int start, const std::vector<unsigned long long>& footprint);
+    void advance(unsigned long int time);
+    void clear();
+
+    // Getters
+    unsigned long int getBase(){return base;}
+    unsigned long int getHorizon(){return mask + 1;}
+    unsigned long long getTiles(unsigned long int time){return time >= base && time - base <= mask ? slots[time & mask] : 0;}
+
+private:
+    void grow(unsigned long int last);
+
+    std::vector<unsigned long long> slots;  // Reserved tiles by tick, indexed by tick & mask
+    unsigned long int mask;                 // Horizon minus one
+    unsigned long int base;                 // Earliest tick held, earlier ticks are free
+};
+
+#endif
\ No newline at end of file
@@ -13,6 +13,27 @@
  *      01DEC2021  R-12-01: Convert class to abstract
  *      04DEC2021  R-12-04: Added lane queues, world queues, and mutexes
  *      07DEC2021  R-12-07: Debugging and code cleanup
+ *      17OCT2026  R-10-17: Added headless stepping engine
+ *      17OCT2026  R-10-17: Added discrete event engine and per pod update hooks
+ *      17OCT2026  R-10-17: Added timed arrivals and idle fast forward
+ *      17OCT2026  R-10-17: Added demand generator support
+ *      17OCT2026  R-10-17: Owned controller threads with join and reset
+ *      17OCT2026  R-10-17: Event driven entry scheduling
+ *      17OCT2026  R-10-17: Lock-free entry ring, entryQueue made protected
+ *      17OCT2026  R-10-17: Double buffered pod state for observers
+ *      17OCT2026  R-10-17: Pod state published through seqlock snapshot
+ *      17OCT2026  R-10-17: Controlled pods held in struct-of-arrays PodStore
+ *      17OCT2026  R-10-17: Lane queues indexed by source node index
+ *      17OCT2026  R-10-17: Lane queues held in ring buffers
+ *      17OCT2026  R-10-17: Departed pods swept from the world queue in one pass
+ *      17OCT2026  R-10-17: Update pass runs over phase buckets
+ *      17OCT2026  R-10-17: Pods moved in one batch bounded by acceleration
+ *      17OCT2026  R-10-17: Vehicles admitted in a tick committed together
+ *      17OCT2026  R-10-17: Entries admitted by the update thread at the start of a tick
+ *      17OCT2026  R-10-17: Entries held back while the controller has no room
+ *      17OCT2026  R-10-17: Event engine empties departed slots as doUpdate does
+ *      17OCT2026  R-10-17: Acceleration limits refused by controllers not planning for them
+ *      17OCT2026  R-10-17: Only departed pods still queued are removed from their lane queue
  * 
  **/
 
@@ -20,27 +41,93 @@
 
 // Constructor
 TrafficController::TrafficController(Intersection* theIntersection, unsigned int tickSpeed)
-    :thisIntersection(theIntersection), tickSpeedMicro(tickSpeed)
+    :entryRing(ENTRY_RING_CAPACITY), thisIntersection(theIntersection), tickSpeedMicro(tickSpeed)
     {
         controllerActive = true;
         globalTime = 0;
-        // Initialize mapping of lane queues
-        for (int i=0; i<theIntersection->getNumNodes(); ++i)
-        {
-            std::string src_node_id = std::to_string(i);
-            std::vector<Pod*> thisLaneQueue;
-            laneQueues.insert({src_node_id, thisLaneQueue});
-        }
+        headlessTicks = 0;
+        headlessSeconds = 0;
+        vehiclesProcessed = 0;
+        totalWait = 0;
+        arrivalsScheduled = 0;
+        demand = NULL;
+        handOffSpawned = false;
+        // Initialize lane queues, one per source node
+        laneQueues.resize(theIntersection->getNumNodes());
     }
 
 // Destructor
 TrafficController::~TrafficController()
+{
+    stopController();
+    joinController();
+    releaseControlled();
+}
+
+/**
+ * releaseControlled
+ * Inputs: None
+ * Outputs: None
+ * Description:
+ *          Frees every pod and every vehicle the controller owns and empties
+ *          the controller's containers, leaving their capacity in place
+ **/
+void TrafficController::releaseControlled()
 {
     for (int i=0; i<controlledPods.size(); ++i)
     {
+        Vehicle* thisVehicle = controlledPods[i]->getVehicle();
         delete controlledPods[i];
+        if (thisVehicle->isControllerOwned())
+        {
+            delete thisVehicle;
+        }
     }
     controlledPods.clear();
+
+    // Free spawned vehicles nobody took ownership of
+    drainEntries();
+    while (!entryQueue.empty())
+    {
+        if (entryQueue.front()->isControllerOwned())
+        {
+            delete entryQueue.front();
+        }
+        entryQueue.pop();
+    }
+    for (int i=0; i<spawnedVehicles.size(); ++i)
+    {
+        delete spawnedVehicles[i];
+    }
+    spawnedVehicles.clear();
+    for (int i=0; i<spawnedOutbox.size(); ++i)
+    {
+        delete spawnedOutbox[i];
+    }
+    spawnedOutbox.clear();
+    // Departed vehicles were collected as spawned or freed above
+    departedVehicles.clear();
+    departedOutbox.clear();
+
+    for (int i=0; i<laneQueues.size(); ++i)
+    {
+        laneQueues[i].clear();
+    }
+    worldQueue.clear();
+    podEvents.clear();
+    arrivals.clear();
+}
+
+// Heap ordering for podEvents, earliest event on top
+static bool laterEvent(const PodEvent& a, const PodEvent& b)
+{
+    return a.time > b.time;
+}
+
+// Heap ordering for arrivals, earliest arrival on top
+static bool laterArrival(const Arrival& a, const Arrival& b)
+{
+    return a.time > b.time || (a.time == b.time && a.order > b.order);
 }
 
 /**
@@ -48,12 +135,17 @@ TrafficController::~TrafficController()
  * Inputs: None
  * Outputs: None
  * Description:
- *          Starts entryCheck and updatePods threads
+ *          Starts the updatePods thread.
+ *          Does nothing if the threads have not been joined yet.
  **/
 void TrafficController::startController()
 {
-    std::thread (&TrafficController::entryCheck, this).detach();
-    std::thread (&TrafficController::updatePods, this).detach();
+    if (!controllerThreads.empty())
+    {
+        return;
+    }
+    controllerActive = true;
+    controllerThreads.push_back(std::thread(&TrafficController::updatePods, this));
 }
 
 /**
@@ -62,57 +154,203 @@ void TrafficController::startController()
  * Outputs: None
  * Description:
  *          Sets controllerActive to false, triggers stoppage of threads
+ *          and wakes any thread waiting out a tick.
  **/
 void TrafficController::stopController()
 {
-    controllerActive = false;
+    {
+        std::lock_guard<std::mutex> lock(protectLifecycle);
+        controllerActive = false;
+    }
+    lifecycleSignal.notify_all();
 }
 
 /**
- * entryCheck
+ * enqueueVehicle
+ * Inputs:
+ *      Vehicle* - Pointer to the vehicle that is joining traffic
+ * Outputs:
+ *      bool - False if the entry ring is full, the vehicle is not queued
+ * Description:
+ *          Lock-free push to the entry ring. Safe from any number of
+ *          threads, the vehicle is admitted at the start of the next tick.
+ **/
+bool TrafficController::enqueueVehicle(Vehicle* entryVehicle)
+{
+    return entryRing.push(entryVehicle);
+}
+
+/**
+ * joinController
  * Inputs: None
  * Outputs: None
  * Description:
- *          Thread function that runs continuously, checks entryQueue
- *          for activity and schedules any new vehicles
+ *          Waits for every controller thread to return.
+ *          Call stopController first or this blocks forever.
  **/
-void TrafficController::entryCheck()
+void TrafficController::joinController()
 {
-    // Make sure stopController has not been called
-    while (controllerActive)
+    for (int i=0; i<controllerThreads.size(); ++i)
     {
-        // Check if there is something in the queue
-        if (!entryQueue.empty())
+        if (controllerThreads[i].joinable())
         {
-            // Protect shared data
-            protectControlledPods.lock();
+            controllerThreads[i].join();
+        }
+    }
+    controllerThreads.clear();
+}
+
+/**
+ * resetController
+ * Inputs: None
+ * Outputs: None
+ * Description:
+ *          Stops and joins the threads, then returns the controller to its
+ *          freshly constructed state so it can run another simulation on
+ *          the same intersection. Pods and owned vehicles are freed, but
+ *          containers keep their capacity. The demand generator is detached,
+ *          call setDemand again for the next run.
+ **/
+void TrafficController::resetController()
+{
+    stopController();
+    joinController();
+    releaseControlled();
+    resetState();
 
-            if (DEBUG) {std::cout << "Entered Scheduler\n";}
+    controllerActive = true;
+    globalTime = 0;
+    headlessTicks = 0;
+    headlessSeconds = 0;
+    vehiclesProcessed = 0;
+    totalWait = 0;
+    arrivalsScheduled = 0;
+    demand = NULL;
+    handOffSpawned = false;
+    snapshot.publish(globalTime, vehiclesProcessed, totalWait, controlledPods);
+}
 
-            // Check vehicle is not being scheduled on top of another vehicle
-            std::map<std::string, std::vector<Pod*>>::iterator it = laneQueues.find(entryQueue.front()->getSource()->nodeID);
-            if (it->second.empty() || globalTime > it->second.back()->getTimestamp())
-            {
-                // Safe to schedule, do scheduling
-                schedulePod(entryQueue.front());
-                entryQueue.pop();
-            }
+/**
+ * waitWhileActive
+ * Inputs:
+ *      std::chrono::microseconds - How long to wait
+ * Outputs:
+ *      bool - False if stopController was called, true otherwise
+ * Description:
+ *          Sleep for controller threads that returns early on stopController
+ **/
+bool TrafficController::waitWhileActive(std::chrono::microseconds duration)
+{
+    std::unique_lock<std::mutex> lock(protectLifecycle);
+    return !lifecycleSignal.wait_for(lock, duration, [this]{return !controllerActive;});
+}
 
-            if (DEBUG) {std::cout << "Exited Scheduler\n";}
+/**
+ * setAccelerationLimited
+ * Inputs:
+ *      bool - Whether pods created afterwards move within their vehicle's limits
+ * Outputs:
+ *      bool - False if the controller does not plan for the limits and nothing changed
+ * Description:
+ *          Only controllers that plan their pods' moves around the limits
+ *          take them. The Auto controller reserves entries and the Light
+ *          controller stops pods from the speed limits alone, so limited
+ *          pods would leave their reservations or run the lights.
+ **/
+bool TrafficController::setAccelerationLimited(bool limited)
+{
+    if (limited && !supportsAccelerationLimits())
+    {
+        return false;
+    }
+    controlledPods.setAccelerationLimited(limited);
+    return true;
+}
 
-            // Protect shared data
-            protectControlledPods.unlock();
-        }
+/**
+ * setDemand
+ * Inputs:
+ *      DemandGenerator* - Pointer to the demand generator, NULL for none
+ *      bool - True to hand spawned vehicles off through collectSpawned
+ * Outputs: None
+ * Description:
+ *          Makes the controller spawn vehicles from the generator on
+ *          globalTime. Spawned vehicles are freed by the controller when
+ *          they leave control, unless they are handed off, in which case
+ *          whoever collects them owns them.
+ **/
+void TrafficController::setDemand(DemandGenerator* generator, bool handOff)
+{
+    demand = generator;
+    handOffSpawned = handOff;
+    if (demand != NULL)
+    {
+        demand->start(globalTime);
     }
 }
 
+/**
+ * collectSpawned
+ * Inputs:
+ *      std::vector<Vehicle*>& - Vector the spawned vehicles are appended to
+ * Outputs: None
+ * Description:
+ *          Hands off vehicles spawned up to the last published tick.
+ *          Caller must hold protectHandOff.
+ **/
+void TrafficController::collectSpawned(std::vector<Vehicle*>& spawned)
+{
+    spawned.insert(spawned.end(), spawnedOutbox.begin(), spawnedOutbox.end());
+    spawnedOutbox.clear();
+}
+
+/**
+ * collectDeparted
+ * Inputs:
+ *      std::vector<Vehicle*>& - Vector the departed vehicles are appended to
+ * Outputs: None
+ * Description:
+ *          Hands back handed off vehicles that left control up to the
+ *          last published tick. The controller no longer touches them.
+ *          Caller must hold protectHandOff.
+ **/
+void TrafficController::collectDeparted(std::vector<Vehicle*>& departed)
+{
+    departed.insert(departed.end(), departedOutbox.begin(), departedOutbox.end());
+    departedOutbox.clear();
+}
+
+/**
+ * publishState
+ * Inputs: None
+ * Outputs: None
+ * Description:
+ *          Publishes the snapshot of every controlled pod, then hands over
+ *          the vehicles spawned and departed since the last publish under
+ *          the short protectHandOff lock.
+ *          Caller must hold protectControlledPods.
+ **/
+void TrafficController::publishState()
+{
+    snapshot.publish(globalTime, vehiclesProcessed, totalWait, controlledPods);
+
+    std::lock_guard<std::mutex> lock(protectHandOff);
+    spawnedOutbox.insert(spawnedOutbox.end(), spawnedVehicles.begin(), spawnedVehicles.end());
+    spawnedVehicles.clear();
+    departedOutbox.insert(departedOutbox.end(), departedVehicles.begin(), departedVehicles.end());
+    departedVehicles.clear();
+}
+
 /**
  * updatePods
  * Inputs: None
  * Outputs: None
  * Description:
  *          Thread function that runs continuously, updates
- *          position of all pods in intersection control
+ *          position of all pods in intersection control.
+ *          Vehicles enqueued since the last tick are taken from the
+ *          entry ring and admitted at the start of the tick, so
+ *          producers never wait on protectControlledPods.
  **/
 void TrafficController::updatePods()
 {
@@ -124,10 +362,17 @@ void TrafficController::updatePods()
 
         if (DEBUG) {std::cout << "----\n";}
         
+        // Scheduling phase, the entry ring is drained with the due arrivals
+        releaseArrivals();
+        admitEntries();
+
         // Perform update
         doUpdate();
         // Update global tick clock
         globalTime++;
+
+        // Tick barrier, observers move on to the new tick
+        publishState();
         
         if (DEBUG) {std::cout << "----\n\n";}
 
@@ -135,6 +380,623 @@ void TrafficController::updatePods()
         protectControlledPods.unlock();
 
         // Update rate at approx tickSpeedMicro microseconds between updates
-        std::this_thread::sleep_for(std::chrono::microseconds(tickSpeedMicro));
+        waitWhileActive(std::chrono::microseconds(tickSpeedMicro));
+    }
+}
+
+/**
+ * doUpdate
+ * Inputs: None
+ * Outputs: None
+ * Description:
+ *          Loops through the phase buckets of the controlled pods and
+ *          asks for their speed through stepBucket, moves them all in
+ *          one batch, then applies the collected signals. Pods that crossed a boundary last tick are
+ *          moved to their new bucket first. Uses OpenMP to speed up the
+ *          update process, every thread walks the buckets in order and
+ *          shares the work of each.
+ **/
+void TrafficController::doUpdate()
+{
+    if (DEBUG) {std::cout << "Entered doUpdate\n";}
+
+    // Prepare post multithreading update flags
+    UpdateSignals signals;
+    signals.popWorld = false;
+
+    // Sort pods into the bucket of their phase
+    controlledPods.sortBuckets();
+
+    // Begin parallel computing for update, buckets hold disjoint pods
+    // so threads move on to the next bucket without waiting
+    controlledPods.holdMoves(true);
+#pragma omp parallel
+    {
+        for (unsigned int p=0; p<POD_PHASES; ++p)
+        {
+            stepBucket(p, signals);
+        }
+    }
+    controlledPods.holdMoves(false);
+
+    // Every pod has asked for its speed, move them all at once
+    controlledPods.applyMoves();
+
+    applySignals(signals);
+
+    // Signal received that a pod left control
+    if (!signals.departed.empty())
+    {
+        removeDeparted();
+        retireDeparted(signals);
+    }
+
+    if (DEBUG) {std::cout << "Exited doUpdate\n";}
+}
+
+/**
+ * stepBucket
+ * Inputs:
+ *      unsigned int - Phase of the bucket
+ *      UpdateSignals& - Signals for the post update
+ * Outputs: None
+ * Description:
+ *          Steps every pod in one phase bucket through stepPod.
+ *          Called by every thread of the update, the pods of the
+ *          bucket are shared out among them.
+ **/
+void TrafficController::stepBucket(unsigned int podPhase, UpdateSignals& signals)
+{
+    std::vector<unsigned int>& bucket = controlledPods.getBucket(podPhase);
+    int N = bucket.size();
+#pragma omp for schedule(dynamic) nowait
+    for (int k=0; k<N; ++k)
+    {
+        // Pods that leave control are retired once the loop is done
+        if (stepPod(bucket[k], signals))
+        {
+            controlledPods[bucket[k]] = NULL;
+        }
+    }
+}
+
+/**
+ * departPod
+ * Inputs:
+ *      unsigned int - Slot of a pod past the end of its lane
+ *      UpdateSignals& - Signals for the post update
+ * Outputs: None
+ * Description:
+ *          Stamps the pod's exit and signals its departure.
+ *          The caller empties the slot.
+ **/
+void TrafficController::departPod(unsigned int slot, UpdateSignals& signals)
+{
+    Pod* thisPod = controlledPods[slot];
+    thisPod->setExitStamp(globalTime);
+#pragma omp critical
+    signals.departed.push_back(thisPod);
+}
+
+/**
+ * applySignals
+ * Inputs:
+ *      UpdateSignals& - Signals collected during the update
+ * Outputs: None
+ * Description:
+ *          Pops the world queue and lane queues as signaled
+ **/
+void TrafficController::applySignals(UpdateSignals& signals)
+{
+    // Signal received to pop the world queue
+    if (signals.popWorld)
+    {
+        worldQueue.erase(worldQueue.begin());
+    }
+
+    // Signal received to pop a lane queue
+    for (int i=0; i<signals.popLane.size(); ++i)
+    {
+        laneQueues[signals.popLane[i]].pop();
+    }
+}
+
+/**
+ * retireDeparted
+ * Inputs:
+ *      UpdateSignals& - Signals holding the departed pods
+ * Outputs: None
+ * Description:
+ *          Deletes departed pods and records their wait times.
+ *          A pod that left while not at the front of its queues
+ *          is removed from them so nothing points at a deleted pod.
+ *          The world queue is swept once for the whole burst, keeping
+ *          its order.
+ **/
+void TrafficController::retireDeparted(UpdateSignals& signals)
+{
+    if (signals.departed.empty())
+    {
+        return;
+    }
+
+    // Drop departed pods from the world queue in one pass
+    if (!worldQueue.empty())
+    {
+        retiredPods.assign(signals.departed.begin(), signals.departed.end());
+        std::sort(retiredPods.begin(), retiredPods.end());
+        unsigned int kept = 0;
+        for (int i=0; i<worldQueue.size(); ++i)
+        {
+            if (!std::binary_search(retiredPods.begin(), retiredPods.end(), worldQueue[i]))
+            {
+                worldQueue[kept++] = worldQueue[i];
+            }
+        }
+        worldQueue.resize(kept);
+    }
+
+    for (int i=0; i<signals.departed.size(); ++i)
+    {
+        Pod* thisPod = signals.departed[i];
+        // Pods normally left their lane queue at its front already
+        if (thisPod->isQueued())
+        {
+            laneQueues[thisPod->getLane()->getSource()->nodeIndex].remove(thisPod);
+        }
+
+        Vehicle* thisVehicle = thisPod->getVehicle();
+        delete thisPod;
+        vehiclesProcessed++;
+        totalWait += thisVehicle->getWaitTime();
+        if (thisVehicle->isControllerOwned())
+        {
+            delete thisVehicle;
+        }
+        else if (handOffSpawned)
+        {
+            departedVehicles.push_back(thisVehicle);
+        }
+    }
+    signals.departed.clear();
+}
+
+/**
+ * removeDeparted
+ * Inputs: None
+ * Outputs: None
+ * Description:
+ *          Removes NULL entries left in controlledPods by departed pods
+ **/
+void TrafficController::removeDeparted()
+{
+    controlledPods.compact();
+}
+
+/**
+ * scheduleArrival
+ * Inputs:
+ *      Vehicle* - Pointer to the arriving vehicle
+ *      unsigned long int - Tick at which the vehicle arrives
+ * Outputs: None
+ * Description:
+ *          Holds a vehicle until the given tick, at which point it is
+ *          pushed to the entryQueue. Vehicles arriving at the same tick
+ *          keep the order they were scheduled in. Known arrivals let the
+ *          headless engines skip idle time up to the next arrival.
+ **/
+void TrafficController::scheduleArrival(Vehicle* arrivingVehicle, unsigned long int time)
+{
+    Arrival thisArrival;
+    thisArrival.time = time;
+    thisArrival.order = arrivalsScheduled++;
+    thisArrival.vehicle = arrivingVehicle;
+    arrivals.push_back(thisArrival);
+    std::push_heap(arrivals.begin(), arrivals.end(), laterArrival);
+}
+
+/**
+ * releaseArrivals
+ * Inputs: None
+ * Outputs: None
+ * Description:
+ *          Pushes every vehicle due by globalTime to the entryQueue:
+ *          the entry ring is drained first, then scheduled arrivals,
+ *          then those from the demand generator
+ **/
+void TrafficController::releaseArrivals()
+{
+    drainEntries();
+
+    while (!arrivals.empty() && arrivals.front().time <= globalTime)
+    {
+        std::pop_heap(arrivals.begin(), arrivals.end(), laterArrival);
+        entryQueue.push(arrivals.back().vehicle);
+        arrivals.pop_back();
+    }
+
+    if (demand == NULL)
+    {
+        return;
+    }
+    Vehicle* newVehicle = demand->nextVehicle(globalTime);
+    while (newVehicle != NULL)
+    {
+        newVehicle->setControllerOwned(!handOffSpawned);
+        if (handOffSpawned)
+        {
+            spawnedVehicles.push_back(newVehicle);
+        }
+        entryQueue.push(newVehicle);
+        newVehicle = demand->nextVehicle(globalTime);
+    }
+}
+
+/**
+ * getNextArrival
+ * Inputs: None
+ * Outputs:
+ *      unsigned long int - Tick of the next arrival, ULONG_MAX if none
+ * Description:
+ *          Earliest of the next scheduled and the next generated arrival
+ **/
+unsigned long int TrafficController::getNextArrival()
+{
+    unsigned long int next = arrivals.empty() ? ULONG_MAX : arrivals.front().time;
+    if (demand != NULL && demand->getNextArrival() < next)
+    {
+        next = demand->getNextArrival();
+    }
+    return next;
+}
+
+/**
+ * admitEntry
+ * Inputs: None
+ * Outputs:
+ *      bool - True if a vehicle was scheduled
+ * Description:
+ *          Schedules the vehicle at the front of the entryQueue unless it
+ *          would be scheduled on top of another vehicle in the same tick
+ *          or the controller has no room for it yet.
+ *          Caller is responsible for protecting shared data.
+ **/
+bool TrafficController::admitEntry()
+{
+    if (entryQueue.empty())
+    {
+        return false;
+    }
+
+    // Check vehicle is not being scheduled on top of another vehicle
+    LaneQueue& thisLaneQueue = laneQueues[entryQueue.front()->getSource()->nodeIndex];
+    if ((thisLaneQueue.empty() || globalTime > thisLaneQueue.back()->getTimestamp()) && hasRoom(entryQueue.front()))
+    {
+        // Safe to schedule, do scheduling
+        schedulePod(entryQueue.front());
+        entryQueue.pop();
+        return true;
+    }
+    return false;
+}
+
+/**
+ * admitEntries
+ * Inputs: None
+ * Outputs: None
+ * Description:
+ *          Schedules vehicles from the entryQueue until the front one
+ *          must wait for the next tick, then lets the controller commit
+ *          the vehicles it admitted together.
+ *          Caller is responsible for protecting shared data.
+ **/
+void TrafficController::admitEntries()
+{
+    while (admitEntry());
+    commitEntries();
+}
+
+/**
+ * fastForward
+ * Inputs:
+ *      unsigned long int - Global time not to go beyond
+ * Outputs:
+ *      unsigned long int - Number of ticks skipped
+ * Description:
+ *          Advances globalTime over idle and steady state spans in one step,
+ *          stopping at the next arrival. The intersection is idle when no pod
+ *          is under control, and steady when every pod is moving at a fixed
+ *          speed with no countdown running out and no queue about to change.
+ *          Nothing is skipped while a vehicle is waiting to be scheduled.
+ **/
+unsigned long int TrafficController::fastForward(unsigned long int limit)
+{
+    if (!entryQueue.empty() || !entryRing.empty() || globalTime >= limit)
+    {
+        return 0;
+    }
+
+    // Never skip past the next arrival
+    unsigned long int target = getNextArrival() < limit ? getNextArrival() : limit;
+    if (target <= globalTime)
+    {
+        return 0;
+    }
+
+    // Check every pod is steady, oldest pods are the most likely not to be
+    for (int i=0; i<controlledPods.size(); ++i)
+    {
+        int speed = 0;
+        unsigned long int quiet = steadyTicks(controlledPods[i], speed);
+        if (quiet == 0)
+        {
+            return 0;
+        }
+        if (quiet < target - globalTime)
+        {
+            target = globalTime + quiet;
+        }
+        controlledPods[i]->setEventState(globalTime, target, speed);
+    }
+
+    // Advance everyone in one go
+    for (int i=0; i<controlledPods.size(); ++i)
+    {
+        controlledPods[i]->syncTo(target);
     }
+
+    unsigned long int skipped = target - globalTime;
+    globalTime = target;
+    return skipped;
+}
+
+/**
+ * step
+ * Inputs: None
+ * Outputs: None
+ * Description:
+ *          Performs one full tick on the calling thread: schedules
+ *          every vehicle that can enter, updates all pods and
+ *          advances the global tick clock. No sleeping or locking.
+ **/
+void TrafficController::step()
+{
+    // Scheduling phase
+    releaseArrivals();
+    admitEntries();
+
+    // Update phase
+    doUpdate();
+    globalTime++;
+}
+
+/**
+ * run
+ * Inputs:
+ *      unsigned long int - Number of ticks to simulate
+ * Outputs: None
+ * Description:
+ *          Steps the controller back to back for the given number of ticks
+ **/
+void TrafficController::run(unsigned long int ticks)
+{
+    runUntil(globalTime + ticks);
+}
+
+/**
+ * runUntil
+ * Inputs:
+ *      unsigned long int - Global time at which to stop
+ * Outputs: None
+ * Description:
+ *          Steps the controller back to back until globalTime reaches
+ *          the given time. Tracks wall time for throughput reporting.
+ **/
+void TrafficController::runUntil(unsigned long int time)
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    unsigned long int startTime = globalTime;
+
+    while (globalTime < time)
+    {
+        // Skip over idle and steady state spans
+        if (fastForward(time) > 0)
+        {
+            continue;
+        }
+        step();
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    headlessTicks += globalTime - startTime;
+    headlessSeconds += elapsed.count();
+}
+
+/**
+ * getTicksPerSecond
+ * Inputs: None
+ * Outputs:
+ *      double - Simulated ticks per wall clock second
+ * Description:
+ *          Reports the throughput of all headless runs so far
+ **/
+double TrafficController::getTicksPerSecond()
+{
+    if (headlessSeconds <= 0)
+    {
+        return 0;
+    }
+    return headlessTicks / headlessSeconds;
+}
+
+/**
+ * planPod
+ * Inputs:
+ *      Pod* - Pointer to a pod whose state is current as of globalTime
+ * Outputs: None
+ * Description:
+ *          Asks the controller how long the pod keeps its current behaviour
+ *          and pushes the pod's next event onto the event heap
+ **/
+void TrafficController::planPod(Pod* thePod)
+{
+    int speed = 0;
+    unsigned long int quiet = steadyTicks(thePod, speed);
+    unsigned long int next = quiet >= ULONG_MAX - globalTime ? ULONG_MAX : globalTime + quiet;
+    thePod->setEventState(globalTime, next, speed);
+
+    PodEvent thisEvent;
+    thisEvent.time = next;
+    thisEvent.pod = thePod;
+    podEvents.push_back(thisEvent);
+    std::push_heap(podEvents.begin(), podEvents.end(), laterEvent);
+}
+
+/**
+ * steadyTicks
+ * Inputs:
+ *      Pod* - Pointer to the pod
+ *      int& - Set to the speed held throughout
+ * Outputs:
+ *      unsigned long int - Number of ticks the pod holds its speed for
+ * Description:
+ *          Same as quietTicks, except a pod still speeding up to the
+ *          quiet speed is never quiet
+ **/
+unsigned long int TrafficController::steadyTicks(Pod* thePod, int& speed)
+{
+    unsigned long int quiet = quietTicks(thePod, speed);
+    if (quiet > 0 && !controlledPods.isSteady(thePod->getSlot(), PodStore::toFixed(speed)))
+    {
+        return 0;
+    }
+    return quiet;
+}
+
+/**
+ * runEvents
+ * Inputs:
+ *      unsigned long int - Global time at which to stop
+ * Outputs: None
+ * Description:
+ *          Discrete event alternative to runUntil. Each pod is only stepped
+ *          at the ticks where its behaviour can change; in between it is
+ *          advanced in one go when it is next needed. When nothing is due and
+ *          no vehicle is waiting to enter, globalTime jumps straight to the
+ *          next event. Produces the same results as runUntil. Controllers
+ *          without per pod update hooks fall back to runUntil.
+ **/
+void TrafficController::runEvents(unsigned long int time)
+{
+    if (!supportsEvents())
+    {
+        runUntil(time);
+        return;
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    unsigned long int startTime = globalTime;
+
+    // Every pod is due at the current tick to begin with
+    podEvents.clear();
+    for (int i=0; i<controlledPods.size(); ++i)
+    {
+        controlledPods[i]->setEventState(globalTime, globalTime, 0);
+        PodEvent thisEvent;
+        thisEvent.time = globalTime;
+        thisEvent.pod = controlledPods[i];
+        podEvents.push_back(thisEvent);
+    }
+    std::make_heap(podEvents.begin(), podEvents.end(), laterEvent);
+
+    while (globalTime < time)
+    {
+        // Scheduling phase, newly created pods are due right away
+        int numPods = controlledPods.size();
+        releaseArrivals();
+        admitEntries();
+        for (int i=numPods; i<controlledPods.size(); ++i)
+        {
+            controlledPods[i]->setEventState(globalTime, globalTime, 0);
+            PodEvent thisEvent;
+            thisEvent.time = globalTime;
+            thisEvent.pod = controlledPods[i];
+            podEvents.push_back(thisEvent);
+            std::push_heap(podEvents.begin(), podEvents.end(), laterEvent);
+        }
+
+        // Update phase, only pods that are due get stepped
+        UpdateSignals signals;
+        signals.popWorld = false;
+        std::vector<Pod*> stepped;
+        while (!podEvents.empty() && podEvents.front().time == globalTime)
+        {
+            std::pop_heap(podEvents.begin(), podEvents.end(), laterEvent);
+            Pod* thisPod = podEvents.back().pod;
+            podEvents.pop_back();
+
+            thisPod->syncTo(globalTime);
+            if (stepPod(thisPod->getSlot(), signals))
+            {
+                // Pods that leave control are retired once the tick is done, as in doUpdate
+                controlledPods[thisPod->getSlot()] = NULL;
+            }
+            else
+            {
+                // Pod now holds its state for the next tick
+                thisPod->setEventState(globalTime + 1, globalTime + 1, 0);
+                stepped.push_back(thisPod);
+            }
+        }
+
+        applySignals(signals);
+
+        // Signal received that a pod left control
+        if (!signals.departed.empty())
+        {
+            removeDeparted();
+            retireDeparted(signals);
+        }
+
+        globalTime++;
+
+        // Plan the next event of every pod that was stepped
+        if (signals.popWorld || !signals.popLane.empty())
+        {
+            // Queue changes can alter the behaviour of any pod, re-plan everyone
+            podEvents.clear();
+            for (int i=0; i<controlledPods.size(); ++i)
+            {
+                controlledPods[i]->syncTo(globalTime);
+                planPod(controlledPods[i]);
+            }
+        }
+        else
+        {
+            for (int i=0; i<stepped.size(); ++i)
+            {
+                planPod(stepped[i]);
+            }
+        }
+
+        // Jump to the next event or arrival if no vehicle is waiting to be scheduled
+        if (entryQueue.empty())
+        {
+            unsigned long int nextTime = podEvents.empty() ? time : podEvents.front().time;
+            nextTime = getNextArrival() < nextTime ? getNextArrival() : nextTime;
+            nextTime = nextTime < time ? nextTime : time;
+            globalTime = nextTime > globalTime ? nextTime : globalTime;
+        }
+    }
+
+    // Bring every pod up to date for the caller
+    for (int i=0; i<controlledPods.size(); ++i)
+    {
+        controlledPods[i]->syncTo(globalTime);
+    }
+    podEvents.clear();
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    headlessTicks += globalTime - startTime;
+    headlessSeconds += elapsed.count();
 }
\ No newline at end of file
@@ -16,6 +16,25 @@
  *      01DEC2021  R-12-01: Convert class to abstract
  *      04DEC2021  R-12-04: Added lane queues, world queues, and mutexes
  *      07DEC2021  R-12-07: Debugging and code cleanup
+ *      17OCT2026  R-10-17: Added headless stepping engine
+ *      17OCT2026  R-10-17: Added discrete event engine and per pod update hooks
+ *      17OCT2026  R-10-17: Added timed arrivals and idle fast forward
+ *      17OCT2026  R-10-17: Added demand generator support
+ *      17OCT2026  R-10-17: Owned controller threads with join and reset
+ *      17OCT2026  R-10-17: Event driven entry scheduling
+ *      17OCT2026  R-10-17: Lock-free entry ring, entryQueue made protected
+ *      17OCT2026  R-10-17: Double buffered pod state for observers
+ *      17OCT2026  R-10-17: Pod state published through seqlock snapshot
+ *      17OCT2026  R-10-17: Controlled pods held in struct-of-arrays PodStore
+ *      17OCT2026  R-10-17: Lane queues indexed by source node index
+ *      17OCT2026  R-10-17: Lane queues held in ring buffers
+ *      17OCT2026  R-10-17: Departed pods swept from the world queue in one pass
+ *      17OCT2026  R-10-17: Update pass runs over phase buckets
+ *      17OCT2026  R-10-17: Pods moved in one batch bounded by acceleration
+ *      17OCT2026  R-10-17: Added hook committing the vehicles admitted in a tick
+ *      17OCT2026  R-10-17: Removed entryCheck thread, updatePods admits entries
+ *      17OCT2026  R-10-17: Added hook holding back vehicles with no room to enter
+ *      17OCT2026  R-10-17: Acceleration limits refused by controllers not planning for them
  * 
  **/
 
@@ -26,19 +45,86 @@
 #include <vector>
 #include <queue>
 #include <map>
+#include <algorithm>
+#include <climits>
 #include <thread>
 #include <mutex>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <omp.h>
 
 #include "intersection.h"
 #include "pod.h"
+#include "demandGenerator.h"
+#include "entryRing.h"
+#include "stateSnapshot.h"
+#include "laneQueue.h"
+
+// Vehicles that can wait in the entry ring before enqueueVehicle fails
+#define ENTRY_RING_CAPACITY 1024
+
+/**
+ * UpdateSignals Struct
+ * Description:
+ *          Data structure for collecting post update flags while pods are
+ *          being updated. Signals are applied once every pod has been updated.
+ * Contains:
+ *      bool popWorld - Signal to pop the world queue
+ *      std::vector<unsigned int> popLane - Source node indices of lane queues to pop
+ *      std::vector<Pod*> departed - Pods that have left intersection control
+ **/
+struct UpdateSignals
+{
+    bool popWorld;
+    std::vector<unsigned int> popLane;
+    std::vector<Pod*> departed;
+};
+
+/**
+ * PodEvent Struct
+ * Description:
+ *          Data structure for the event engine heap
+ * Contains:
+ *      unsigned long int time - Tick at which the pod must be updated
+ *      Pod* pod - Pointer to the pod
+ **/
+struct PodEvent
+{
+    unsigned long int time;
+    Pod* pod;
+};
+
+/**
+ * Arrival Struct
+ * Description:
+ *          Data structure for vehicles scheduled to arrive at a later tick
+ * Contains:
+ *      unsigned long int time - Tick at which the vehicle joins the entry queue
+ *      unsigned long int order - Tie breaker keeping arrivals in order of scheduling
+ *      Vehicle* vehicle - Pointer to the arriving vehicle
+ **/
+struct Arrival
+{
+    unsigned long int time;
+    unsigned long int order;
+    Vehicle* vehicle;
+};
 
 /** TrafficController Class
  *  Description:
  *          Abstract class that serves as foundation for traffic controllers.
  *          Contains a thread for checking for entries and a thread for performing
  *          updates. A global controllerActive boolean determines whether the
- *          the threads stay alive.
+ *          the threads stay alive. The controller owns its threads, so
+ *          stopController followed by joinController is a full shutdown and
+ *          resetController rewinds it for another run while keeping its
+ *          allocations. Observers never take the update mutex: at the end
+ *          of every tick the update thread publishes a snapshot that
+ *          readers copy without blocking it, so tick N is read while tick
+ *          N+1 is computed. Alternatively, the controller can be stepped
+ *          headless on the calling thread with step, run and runUntil, or
+ *          driven by the discrete event engine with runEvents.
  **/
 class TrafficController
 {
@@ -47,37 +133,104 @@ public:
     TrafficController(Intersection* theIntersection, unsigned int tickSpeed);
 
     // Destructors
-    ~TrafficController();
+    virtual ~TrafficController();
 
     // Member Functions
     void startController();
     void stopController();
+    void joinController();
+    void resetController();
+    bool enqueueVehicle(Vehicle* entryVehicle);
+    void setDemand(DemandGenerator* generator, bool handOff = false);
+    bool setAccelerationLimited(bool limited);
+    void collectSpawned(std::vector<Vehicle*>& spawned);
+    void collectDeparted(std::vector<Vehicle*>& departed);
 
     // Virtual Member Functions
     virtual void schedulePod(Vehicle* entryVehicle) = 0;
-    virtual void doUpdate() = 0;
+    virtual void doUpdate();
+    virtual void applySignals(UpdateSignals& signals);
+    virtual void resetState(){}
+    virtual void commitEntries(){}
+    virtual bool hasRoom(Vehicle* entryVehicle){return true;}
+    virtual bool supportsAccelerationLimits(){return false;}
+
+    // Per Pod Update Hooks (required by doUpdate and runEvents)
+    virtual bool stepPod(unsigned int slot, UpdateSignals& signals){return false;}
+    virtual void stepBucket(unsigned int podPhase, UpdateSignals& signals);
+    virtual unsigned long int quietTicks(Pod* thePod, int& speed){return 0;}
+    virtual bool supportsEvents(){return false;}
 
     // Thread Functions
-    void entryCheck();
     void updatePods();
 
+    // Headless Engine (do not mix with startController)
+    void scheduleArrival(Vehicle* arrivingVehicle, unsigned long int time);
+    void releaseArrivals();
+    unsigned long int drainEntries(){return entryRing.drain(entryQueue);}
+    bool admitEntry();
+    void admitEntries();
+    unsigned long int fastForward(unsigned long int limit);
+    void step();
+    void run(unsigned long int ticks);
+    void runUntil(unsigned long int time);
+
+    // Discrete Event Engine (do not mix with startController)
+    void runEvents(unsigned long int time);
+
     // Getters
     bool getControllerActive(){return controllerActive;}
     unsigned long int getGlobalTime(){return globalTime;}
+    void readSnapshot(Snapshot& copy){snapshot.read(copy);}
     unsigned int getTickSpeedMicro(){return tickSpeedMicro;}
+    unsigned long int getHeadlessTicks(){return headlessTicks;}
+    unsigned long int getNextArrival();
+    double getTicksPerSecond();
+    unsigned long int getVehiclesProcessed(){return vehiclesProcessed;}
+    double getAverageWait(){return vehiclesProcessed ? totalWait / vehiclesProcessed : 0;}
 
 public:
-    std::queue<Vehicle*> entryQueue;        // Queue of Vehicles waiting to be scheduled
     std::mutex protectControlledPods;       // Mutex for preventing data races
+    std::mutex protectHandOff;              // Mutex for published spawned and departed vehicles
 
 protected:
-    bool controllerActive;                  // Status of controller
+    EntryRing entryRing;                    // Lock-free inbox of enqueueVehicle, drained by the scheduler
+    std::queue<Vehicle*> entryQueue;        // Queue of Vehicles waiting to be scheduled
+    std::atomic<bool> controllerActive;     // Status of controller
+    std::vector<std::thread> controllerThreads; // Threads started for the controller, joined by joinController
+    std::mutex protectLifecycle;            // Mutex for waking threads on stopController
+    std::condition_variable lifecycleSignal;    // Signalled by stopController
     Intersection* thisIntersection;         // Pointer to Intersection object
-    std::vector<Pod*> controlledPods;       // Vector of all pods under controller control
-    std::map<std::string, std::vector<Pod*>> laneQueues;        // Mapping of lanes and their queues (in the form of a vector)
+    PodStore controlledPods;                // Store of all pods under controller control
+    std::vector<LaneQueue> laneQueues;      // Queue of every lane (in the form of a ring buffer) by source node index
     std::vector<Pod*> worldQueue;           // Vector of all pods that have not gone through the intersection yet
+    std::vector<Pod*> retiredPods;          // Departed pods sorted by address, reused by retireDeparted
     unsigned long int globalTime;           // A way to track time
     unsigned int tickSpeedMicro;            // Update speed (How fast time is going)
+    unsigned long int headlessTicks;        // Ticks simulated by run and runUntil
+    double headlessSeconds;                 // Wall time spent in run and runUntil
+    unsigned long int vehiclesProcessed;    // Number of vehicles that have left control
+    double totalWait;                       // Sum of wait times of processed vehicles
+    std::vector<PodEvent> podEvents;        // Min heap of pod events used by runEvents
+    std::vector<Arrival> arrivals;          // Min heap of vehicles arriving at a later tick
+    unsigned long int arrivalsScheduled;    // Number of arrivals ever scheduled
+    DemandGenerator* demand;                // Pointer to demand generator, NULL if none
+    bool handOffSpawned;                    // Whether spawned vehicles are handed off to collectSpawned
+    std::vector<Vehicle*> spawnedVehicles;  // Spawned vehicles not yet published
+    std::vector<Vehicle*> departedVehicles; // Handed off vehicles that left control, not yet published
+    std::vector<Vehicle*> spawnedOutbox;    // Published spawned vehicles waiting to be collected
+    std::vector<Vehicle*> departedOutbox;   // Published departed vehicles waiting to be collected
+    StateSnapshot snapshot;                 // Pod state published at the end of every tick
+
+    // Helper Functions
+    bool waitWhileActive(std::chrono::microseconds duration);
+    void releaseControlled();
+    void publishState();
+    void retireDeparted(UpdateSignals& signals);
+    void departPod(unsigned int slot, UpdateSignals& signals);
+    void removeDeparted();
+    unsigned long int steadyTicks(Pod* thePod, int& speed);
+    void planPod(Pod* thePod);
 };
 
 #endif
\ No newline at end of file
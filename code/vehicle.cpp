@@ -16,38 +16,56 @@
  *      06DEC2021  R-12-06: Added flag to check if vehicle has exited
  *                          intersection
  *      07DEC2021  R-12-07: Debugging and code cleanup
+ *      17OCT2026  R-10-17: Added flag for vehicles owned by traffic controller
+ *      17OCT2026  R-10-17: Allocated from a slab pool
+ *      17OCT2026  R-10-17: Numbered vehicles, compact record
+ *      17OCT2026  R-10-17: update bounded by acceleration and maximum speed
+ *      17OCT2026  R-10-17: update bounded by deceleration
  * 
  **/
 
 #include "vehicle.h"
 
-// Constructor
+// Constructor - Named Version
 Vehicle::Vehicle(std::string id, double mS, double mTS, double a, Node* src, Node* dest)
-    :vehicleID(id), maxSpeed(mS), maxTurnSpeed(mTS), acceleration(a), source(src), destination(dest)
+    :Vehicle((unsigned long int)0, mS, mTS, a, src, dest)
     {
-        initialSpeed = source->speedLimit;
-        currentSpeed = initialSpeed;
-        initialAcceleration = 0;
-        currentAcceleration = 0;
-        currentTurning = false;
-        crashed = false;
-        underTrafficControl = false;
+        vehicleName = id;
+    }
+
+// Constructor - Numbered Version
+Vehicle::Vehicle(unsigned long int number, double mS, double mTS, double a, Node* src, Node* dest)
+    :source(src), destination(dest), vehicleNumber(number), maxSpeed(mS), maxTurnSpeed(mTS), acceleration(a), deceleration(a * DEFAULT_BRAKING)
+    {
+        currentSpeed = source->speedLimit;
         pod = NULL;
+        waitTime = 0;
+        underTrafficControl = false;
         exited = false;
+        controllerOwned = false;
     }
 
 /**
  * update
  * Inputs:
- *      double - Speed of the vehicle
+ *      double - Speed asked of the vehicle
  * Outputs:
  *      double - Distance traveled in one tick
  * Description:
- *          Calculates how far the vehicle traveled in one tick
+ *          Calculates how far the vehicle traveled in one tick. The
+ *          vehicle speeds up by at most its acceleration and never goes
+ *          beyond its maximum speed. It slows down by at most its
+ *          deceleration, which wins over the maximum speed. Pods under
+ *          a traffic controller are moved the same way by PodStore.
  **/
 double Vehicle::update(double speed)
 {
-    currentSpeed = speed;
+    double reach = currentSpeed + acceleration;
+    speed = speed < reach ? speed : reach;
+    speed = speed < maxSpeed ? speed : maxSpeed;
+    double floor = currentSpeed - deceleration;
+    speed = speed > floor ? speed : floor;
+    currentSpeed = speed > 0 ? speed : 0;
     double distTraveled = currentSpeed;
     return distTraveled;
 }
@@ -64,4 +82,56 @@ void Vehicle::exit(unsigned long int wait)
 {
     exited = true;
     waitTime = wait;
+}
+
+/**
+ * operator new
+ * Inputs:
+ *      std::size_t - Size of the object
+ * Outputs:
+ *      void* - Memory for the vehicle
+ * Description:
+ *          Takes a block from the vehicle pool. Objects larger than the
+ *          pool's blocks fall back to the global allocator.
+ **/
+void* Vehicle::operator new(std::size_t size)
+{
+    if (size > getPool().getBlockSize())
+    {
+        return ::operator new(size);
+    }
+    return getPool().allocate();
+}
+
+/**
+ * operator delete
+ * Inputs:
+ *      void* - Memory of the destroyed vehicle
+ *      std::size_t - Size of the object
+ * Outputs: None
+ * Description:
+ *          Returns the block to the vehicle pool
+ **/
+void Vehicle::operator delete(void* block, std::size_t size)
+{
+    if (size > getPool().getBlockSize())
+    {
+        ::operator delete(block);
+        return;
+    }
+    getPool().release(block);
+}
+
+/**
+ * getPool
+ * Inputs: None
+ * Outputs:
+ *      SlabPool& - Pool shared by every vehicle
+ * Description:
+ *          Creates the pool on first use
+ **/
+SlabPool& Vehicle::getPool()
+{
+    static SlabPool pool(sizeof(Vehicle));
+    return pool;
 }
\ No newline at end of file
@@ -18,6 +18,10 @@
  *      06DEC2021  R-12-06: Added flag to check if vehicle has exited
  *                          intersection
  *      07DEC2021  R-12-07: Debugging and code cleanup
+ *      17OCT2026  R-10-17: Added flag for vehicles owned by traffic controller
+ *      17OCT2026  R-10-17: Allocated from a slab pool
+ *      17OCT2026  R-10-17: Numbered vehicles with lazy text IDs, compact record
+ *      17OCT2026  R-10-17: Added deceleration
  * 
  **/
 
@@ -25,73 +29,89 @@
 #define VEHICLE_H
 
 #include "lane.h"
+#include "slabPool.h"
 
 #define SLOW_DOWN 0
 #define MAINTAIN 1
 #define SPEED_UP 2
 
+// Deceleration of a vehicle as a multiple of its acceleration, unless set
+#define DEFAULT_BRAKING 2
+
 /**
  * Vehicle Class
  * Description:
- *          Class that simulates a vehicle. Vehicle is not self aware of position
+ *          Class that simulates a vehicle. Vehicle is not self aware of position.
+ *          new and delete recycle vehicles through a shared slab pool.
+ *          Vehicles are identified by a number; the text ID is only built
+ *          when asked for, unless the vehicle was given a name.
  **/
 class Vehicle
 {
 public:
     // Constructors
     Vehicle(std::string id, double mS, double mTS, double a, Node* src, Node* dest);
+    Vehicle(unsigned long int number, double mS, double mTS, double a, Node* src, Node* dest);
 
     // Member Functions
     double update(double speed);
     void exit(unsigned long int wait);
 
+    // Pool Allocation
+    static void* operator new(std::size_t size);
+    static void operator delete(void* block, std::size_t size);
+    static SlabPool& getPool();
+
     // Setters
     void setTrafficControl(bool control){underTrafficControl = control;}
     void setPod(void* ptr){pod = ptr;}
+    void setControllerOwned(bool owned){controllerOwned = owned;}
+    void setDeceleration(double d){deceleration = d;}
 
     // Getters
-    std::string getVehicleID(){return vehicleID;}
+    std::string getVehicleID(){return vehicleName.empty() ? std::to_string(vehicleNumber) : vehicleName;}
+    unsigned long int getVehicleNumber(){return vehicleNumber;}
     void* getPod(){return pod;}
     double getWaitTime(){return waitTime;}
     double getMaxSpeed(){return maxSpeed;}
     double getMaxTurnSpeed(){return maxTurnSpeed;}
     double getAcceleration(){return acceleration;}
-    double getInitialSpeed(){return initialSpeed;}
-    double getInitialAcceleration(){return initialAcceleration;}
+    double getDeceleration(){return deceleration;}
+    double getInitialSpeed(){return source->speedLimit;}
+    double getInitialAcceleration(){return 0;}
     Node* getSource(){return source;}
     Node* getDestination(){return destination;}
     double getCurrentSpeed(){return currentSpeed;}
-    double getCurrentAcceleration(){return currentAcceleration;}
-    bool isTurning(){return currentTurning;}
-    bool isCrashed(){return crashed;}
+    double getCurrentAcceleration(){return 0;}
+    bool isTurning(){return false;}
+    bool isCrashed(){return false;}
     bool isUnderTrafficControl(){return underTrafficControl;}
     bool isExited(){return exited;}
+    bool isControllerOwned(){return controllerOwned;}
 
 protected:
-    std::string vehicleID;          // Unique vehicle identifier
+    // Vehicle Identity and Route
+    Node* source;                   // Source node
+    Node* destination;              // Destination node
     void* pod;                      // Pointer to pod
+    unsigned long int vehicleNumber;    // Vehicle number, text ID when unnamed
     double waitTime;                // Time delayed in intersection
 
     // Vehicle Properties
-    double maxSpeed;                // Maximum speed capability
-    double maxTurnSpeed;            // Maximum turning speed capability
-    double acceleration;            // Acceleration constant
-
-    // Vehicle Initial State
-    double initialSpeed;            // Initial speed upon existence
-    double initialAcceleration;     // Initial acceleration upon existence
-    Node* source;                   // Source node
-    Node* destination;              // Destination node
+    float maxSpeed;                 // Maximum speed capability
+    float maxTurnSpeed;             // Maximum turning speed capability
+    float acceleration;             // Acceleration constant
+    float deceleration;             // Braking constant
 
     // Vehicle Current State
-    double currentSpeed;            // Current speed
-    double currentAcceleration;     // Current acceleration
-    bool currentTurning;            // Whether or not vehicle is turning
-    bool crashed;                   // Whether or not vehicle has been involved in a collision
+    float currentSpeed;             // Current speed
 
     // Vehicle Control
     bool underTrafficControl;       // Whether or not vehicle is under traffic controller control
     bool exited;                    // Whether or not vehicle has exited traffic controller control
+    bool controllerOwned;           // Whether or not traffic controller frees vehicle on exit
+
+    std::string vehicleName;        // Name given at construction, empty when numbered
 };
 
 #endif
\ No newline at end of file
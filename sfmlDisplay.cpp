@@ -12,17 +12,27 @@
  *      05DEC2021  R-12-05: Document Created, initial coding
  *      06DEC2021  R-12-06: Full debugging and successful SFML setup
  *      07DEC2021  R-12-07: Debugging and code cleanup
+ *      17OCT2026  R-10-17: Vehicles spawned by traffic controller on simulated time
+ *      17OCT2026  R-10-17: Added random seed argument
+ *      17OCT2026  R-10-17: Join traffic controller threads on cleanup
+ *      17OCT2026  R-10-17: Draw from published front state, no update mutex
+ *      17OCT2026  R-10-17: Draw from lock-free snapshot
+ *      17OCT2026  R-10-17: Recycle sprites of departed vehicles
+ *      17OCT2026  R-10-17: Departed vehicles removed in one compaction pass
  * 
  **/
 
 #include "code/debugSetup.h"
 #include <SFML/Graphics.hpp>
 #include <cmath>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "code/intersect4wsl.h"
 #include "code/autoTrafficController.h"
 #include "code/lightTrafficController.h"
 #include "code/stopTrafficController.h"
+#include "code/demandGenerator.h"
 
 
 // Window Dimension Constants
@@ -42,10 +52,13 @@ unsigned int controllerType;
 #define DEFAULT_TICK_MICROS 100000
 unsigned int tickSpeed;
 
-// Vehicle Spawn Chance per Iteration
+// Expected Vehicles per 100 Ticks
 #define DEFAULT_PROB 25
 unsigned int probability;
 
+// Random Seed (current time unless given)
+unsigned int seed;
+
 // Fonts
 sf::Font thinFont;
 sf::Font regFont;
@@ -54,9 +67,11 @@ sf::Font boldFont;
 // Global Variables
 Intersect4WSL* theIntersection;
 TrafficController* theTrafficController;
+DemandGenerator* theDemand;
 sf::Texture textureCollection[8];
 std::vector<Vehicle*> vehicleCollection;
 std::vector<sf::Sprite*> spriteCollection;
+std::vector<sf::Sprite*> spareSprites;
 
 /**
  * Coord
@@ -98,6 +113,7 @@ int main(int argc, char *argv[])
     controllerType = AUTO;
     tickSpeed = DEFAULT_TICK_MICROS;
     probability = DEFAULT_PROB;
+    seed = time(NULL);
     // Check for second command line argument (--help or Controller Type)
     if (argc >= 2)
     {
@@ -107,16 +123,17 @@ int main(int argc, char *argv[])
         {
             std::cout << "\nTraffic Control Simulator - Command Line Interface Instructions\n\n"
                       << "Command line input format:\n"
-                      << "./trafficSim [-T] [-R] [-P]\n"
-                      << "Note that argument [-R] must come after a [-T] argument and a [-P] argument must come after both.\n\n"
+                      << "./trafficSim [-T] [-R] [-P] [-D]\n"
+                      << "Note that argument [-R] must come after a [-T] argument, a [-P] argument must come after both and a [-D] argument must come last.\n\n"
                       << "Arguments:\n"
                       << "           [-T]: Traffic Control Simulation Type. Options are:\n"
                       << "                 -A    Autonomous Simulation\n"
                       << "                 -L    Traffic Light Controlled Simulation (Coming Soon!)\n"
                       << "                 -S    Stop Sign Controlled Simulation\n"
                       << "           [-R]: Tick Rate in microseconds. Input a positive integer.\n"
-                      << "           [-P]: Spawn Probability as a percent. Input a positive integer between 1 and 100.\n"
-                      << "With no arguments, the default operation is autonomous with tick speed 100ms and probability of 25\n\n";
+                      << "           [-P]: Spawn Rate as expected vehicles per 100 ticks across all approaches. Input a positive integer between 1 and 100.\n"
+                      << "           [-D]: Random Seed. Input a non-negative integer. The same seed reproduces the same vehicles.\n"
+                      << "With no arguments, the default operation is autonomous with tick speed 100ms, spawn rate of 25 and a seed from the current time\n\n";
             return 0;
         }
         // Check Number of Characters
@@ -208,11 +225,29 @@ int main(int argc, char *argv[])
             return 1;
         }
     }
+    // Check for fifth command line argument (Random Seed)
+    if (argc >= 5)
+    {
+        std::string typeArg = argv[4];
+        // Check for positive value
+        for (int i=0; i<typeArg.length(); ++i)
+        {
+            if (!isdigit(typeArg[i]))
+            {
+                std::cerr << "Invalid Command Line Input!\n"
+                          << "Found non-digit" << typeArg[i] << std::endl
+                          << "Run --help for more info.\n"
+                          << "Quitting...\n";
+                return 1;
+            }
+        }
+        seed = stoul(typeArg);
+    }
     // Check for too many args
-    if (argc > 4)
+    if (argc > 5)
     {
         std::cerr << "Too many arguments!\n"
-                    << "Received " << argc << ", support only offer up to 4.\n"
+                    << "Received " << argc << ", support only offer up to 5.\n"
                     << "Run --help for more info.\n"
                     << "Quitting...\n";
         return 1;
@@ -271,7 +306,6 @@ int main(int argc, char *argv[])
     /**
      * Environment Setup
      **/
-    srand(time(NULL));
     double speedLimit = DEFAULT_SPEED_LIMIT;
     // For scaling the dimensions of the intersection on a screen
     double scale = controllerType == AUTO ? 40 : 36;
@@ -291,6 +325,10 @@ int main(int argc, char *argv[])
             theTrafficController = new AutoTrafficController(theIntersection, tickSpeed);
             break;
     }
+    // Spawn vehicles on simulated time, split evenly across approaches
+    theDemand = new DemandGenerator(theIntersection, seed);
+    theDemand->setArrivalRates(probability / 100.0 / theIntersection->getNumNodes());
+    theTrafficController->setDemand(theDemand, true);
     // Start the Controller
     theTrafficController->startController();
     // Start traffic lights thread if a traffic light controller
@@ -306,6 +344,12 @@ int main(int argc, char *argv[])
     unsigned long int vehiclesProcessed = 0;
     double averageWait = 0;
 
+    // Per frame copies of the published state
+    std::vector<Vehicle*> departedVehicles;
+    Snapshot frameState;
+    std::unordered_map<Vehicle*, PodState*> frameLookup;
+    std::unordered_set<Vehicle*> departedLookup;
+
     /**
      * Draw Start Screen
      **/
@@ -327,9 +371,6 @@ int main(int argc, char *argv[])
             continue;
         }
 
-        // Spawn a Vehicle
-        vehicleSpawner();
-
         /**
          * Draw everything
          **/
@@ -340,33 +381,65 @@ int main(int argc, char *argv[])
         window.draw(spriteBackground);
 
         // Draw Vehicles
-        // Protect Shared Data
-        theTrafficController->protectControlledPods.lock();
-        // Loop through vehicle collection and display or remove
-        for (int i=0; i<vehicleCollection.size(); ++i)
+        // Pick up vehicles spawned and vehicles that have left
+        theTrafficController->protectHandOff.lock();
+        vehicleSpawner();
+        departedVehicles.clear();
+        theTrafficController->collectDeparted(departedVehicles);
+        theTrafficController->protectHandOff.unlock();
+        // Copy the last published tick without blocking updates
+        theTrafficController->readSnapshot(frameState);
+
+        // Record vehicles that have left
+        departedLookup.clear();
+        for (int i=0; i<departedVehicles.size(); ++i)
         {
-            Vehicle* thisVehicle = vehicleCollection[i];
-            // Remove vehicle if exited
-            if (thisVehicle->isExited())
+            Vehicle* thisVehicle = departedVehicles[i];
+            vehiclesProcessed++;
+            double waitTime = controllerType == STOP ? thisVehicle->getWaitTime()-5 : thisVehicle->getWaitTime();
+            averageWait = (averageWait * ((double)vehiclesProcessed-1) + waitTime) / (double) vehiclesProcessed;
+            departedLookup.insert(thisVehicle);
+        }
+
+        // Remove them in one pass, keeping draw order
+        if (!departedLookup.empty())
+        {
+            int kept = 0;
+            for (int i=0; i<vehicleCollection.size(); ++i)
             {
-                vehiclesProcessed++;
-                double waitTime = controllerType == STOP ? thisVehicle->getWaitTime()-5 : thisVehicle->getWaitTime();
-                averageWait = (averageWait * ((double)vehiclesProcessed-1) + waitTime) / (double) vehiclesProcessed;
-                delete thisVehicle;
-                delete spriteCollection[i];
-                vehicleCollection.erase(vehicleCollection.begin() + i);
-                spriteCollection.erase(spriteCollection.begin() + i);
-                --i;
-                continue;
+                if (departedLookup.count(vehicleCollection[i]))
+                {
+                    spareSprites.push_back(spriteCollection[i]);
+                    delete vehicleCollection[i];
+                    continue;
+                }
+                vehicleCollection[kept] = vehicleCollection[i];
+                spriteCollection[kept] = spriteCollection[i];
+                kept++;
             }
+            vehicleCollection.resize(kept);
+            spriteCollection.resize(kept);
+        }
+
+        // Index the frame by vehicle
+        frameLookup.clear();
+        for (int i=0; i<frameState.pods.size(); ++i)
+        {
+            frameLookup[frameState.pods[i].vehicle] = &frameState.pods[i];
+        }
+
+        // Loop through vehicle collection and display
+        for (int i=0; i<vehicleCollection.size(); ++i)
+        {
+            Vehicle* thisVehicle = vehicleCollection[i];
             // Check if vehicle is not in traffic controller control yet
-            Pod* podPtr = (Pod*)(thisVehicle->getPod());
-            if (podPtr == NULL)
+            std::unordered_map<Vehicle*, PodState*>::iterator stateIt = frameLookup.find(thisVehicle);
+            if (stateIt == frameLookup.end())
             {
                 continue;
             }
             // Get vehicle coordinates
-            Coord pos = getPos(podPtr->getLane()->getLaneID(), podPtr->getPosition());
+            Coord pos = getPos(stateIt->second->lane->getLaneID(), stateIt->second->position);
             // Scale vehicle coordinates
             pos.x = WINDOW_XDIM/2 + pos.x * scale;
             pos.y = WINDOW_YDIM/2 + pos.y * scale;
@@ -381,8 +454,6 @@ int main(int argc, char *argv[])
             vehicleSprite->setRotation(pos.r);
             window.draw(*vehicleSprite);
         }
-        // Unlock Shared Data
-        theTrafficController->protectControlledPods.unlock();
 
         // Draw Text
         window.draw(titleText);
@@ -410,13 +481,15 @@ int main(int argc, char *argv[])
  * Inputs: None
  * Outputs: None
  * Description:
- *          Stops traffic controller threads.
+ *          Stops and joins traffic controller threads.
  *          Frees all allocated memory.
  **/
 void cleanup()
 {
     theTrafficController->stopController();
+    theTrafficController->joinController();
     delete theTrafficController;
+    delete theDemand;
     delete theIntersection;
     for (int i=0; i<vehicleCollection.size(); ++i)
     {
@@ -425,6 +498,11 @@ void cleanup()
     }
     vehicleCollection.clear();
     spriteCollection.clear();
+    for (int i=0; i<spareSprites.size(); ++i)
+    {
+        delete spareSprites[i];
+    }
+    spareSprites.clear();
 }
 
 /**
@@ -432,46 +510,36 @@ void cleanup()
  * Inputs: None
  * Outputs: None
  * Description:
- *          Creates and allocates memory for Vehicle and Sprite objects
- *          Pushes created vehicles to the Traffic Controller's Entry Queue
+ *          Collects vehicles spawned by the Traffic Controller's demand
+ *          generator and gives them Sprite objects, reusing sprites of
+ *          departed vehicles before allocating new ones.
+ *          Caller must hold the controller's protectHandOff mutex.
  **/
 void vehicleSpawner()
 {
-    // Spawn with given probability
-    if (rand() % 100 > probability)
-    {
-        return;
-    }
-
-    // Create random vehicle ID
-    std::string randomizedID = "";
-    for (int i=0; i<10; ++i)
-    {
-        randomizedID += std::to_string(rand() % 10);
-    }
-
-    // Choose random source and destination
-    unsigned int src = rand() % theIntersection->getNumNodes();
-    unsigned int dest = rand() % theIntersection->getNumNodes();
-    if (src == dest)
-    {
-        return;
+    std::vector<Vehicle*> spawned;
+    theTrafficController->collectSpawned(spawned);
+    for (int i=0; i<spawned.size(); ++i)
+    {
+        vehicleCollection.push_back(spawned[i]);
+        // Choose a sprite (Just Cows for now)
+        unsigned int carType = 7;
+        // Reuse a spare sprite, allocate memory only if none are left
+        Sprite* spriteVehicle;
+        if (!spareSprites.empty())
+        {
+            spriteVehicle = spareSprites.back();
+            spareSprites.pop_back();
+        }
+        else
+        {
+            spriteVehicle = new Sprite;
+        }
+        spriteVehicle->setTexture(textureCollection[carType]);
+        spriteVehicle->setScale(Vector2f(0.5f, 0.5f));
+        spriteVehicle->setOrigin(30, 30);
+        spriteCollection.push_back(spriteVehicle);
     }
-
-    // Create vehicle, allocate memory
-    Vehicle* newVehicle = new Vehicle(randomizedID, 10, 10, 1, theIntersection->getNode(std::to_string(src)), theIntersection->getNode(std::to_string(dest)));
-    vehicleCollection.push_back(newVehicle);
-    // Choose a sprite (Just Cows for now)
-    unsigned int carType = 7;
-    // Create sprite, allocate memory
-    Sprite* spriteVehicle = new Sprite;
-    spriteVehicle->setTexture(textureCollection[7]);
-    spriteVehicle->setScale(Vector2f(0.5f, 0.5f));
-    spriteVehicle->setOrigin(30, 30);
-    spriteCollection.push_back(spriteVehicle);
-
-    // Push vehicle to traffic controller's entry queue
-    theTrafficController->entryQueue.push(newVehicle);
 }
 
 /**
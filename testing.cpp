@@ -14,6 +14,27 @@
  *      04DEC2021  R-12-04: Added TEST_ADDVEHICLES and TEST_STOPCONTROLLER
  *      06DEC2021  R-12-06: Added TEST_TRAFFICJAM
  *      07DEC2021  R-12-07: Debugging and code cleanup
+ *      17OCT2026  R-10-17: Added TEST_HEADLESS
+ *      17OCT2026  R-10-17: Added discrete event engine option to TEST_HEADLESS
+ *      17OCT2026  R-10-17: Spread TEST_HEADLESS arrivals over time
+ *      17OCT2026  R-10-17: TEST_HEADLESS vehicles spawned by demand generator
+ *      17OCT2026  R-10-17: Added random seed argument, removed rand
+ *      17OCT2026  R-10-17: TEST_HEADLESS replications, join controller on cleanup
+ *      17OCT2026  R-10-17: Vehicles enqueued through enqueueVehicle
+ *      17OCT2026  R-10-17: TEST_HEADLESS reports pool statistics
+ *      17OCT2026  R-10-17: TEST_INTERSECTION checks allowed lane bitmasks
+ *      17OCT2026  R-10-17: TEST_HEADLESS acceleration limits option
+ *      17OCT2026  R-10-17: TEST_HEADLESS tile reservations option
+ *      17OCT2026  R-10-17: TEST_HEADLESS ordering budget option
+ *      17OCT2026  R-10-17: TEST_HEADLESS platoons option
+ *      17OCT2026  R-10-17: Added TEST_PLATOONS
+ *      17OCT2026  R-10-17: TEST_HEADLESS rejects the Light controller
+ *      17OCT2026  R-10-17: TEST_HEADLESS ordered entries option replaces the ordering budget
+ *      17OCT2026  R-10-17: Added TEST_KINEMATICS
+ *      17OCT2026  R-10-17: Acceleration limits checked to be refused by Auto and Light
+ *      17OCT2026  R-10-17: TEST_HEADLESS ordering limit option
+ *      17OCT2026  R-10-17: TEST_HEADLESS quits on platoons with tiles
+ *      17OCT2026  R-10-17: Added TEST_ENGINES
  * 
  **/
 
@@ -23,6 +44,8 @@
 #include "code/autoTrafficController.h"
 #include "code/lightTrafficController.h"
 #include "code/stopTrafficController.h"
+#include "code/demandGenerator.h"
+#include <map>
 
 // Default Speed Limit
 #define DEFAULT_SPEED_LIMIT 4
@@ -32,6 +55,167 @@
 #define TEST_ADDVEHICLES 0
 #define TEST_STOPCONTROLLER 0
 #define TEST_TRAFFICJAM 1
+#define TEST_HEADLESS 0
+#define TEST_PLATOONS 0
+#define TEST_KINEMATICS 0
+#define TEST_ENGINES 0
+
+// Ticks simulated by TEST_HEADLESS
+#define HEADLESS_TICKS 100000
+// Engine used by TEST_HEADLESS (0 for tick stepping, 1 for discrete events)
+#define HEADLESS_EVENTS 0
+// Replications run by TEST_HEADLESS on one reset controller
+#define HEADLESS_REPLICATIONS 1
+// Back TEST_HEADLESS pod and vehicle pools with huge pages (0 for off, 1 for on)
+#define HEADLESS_HUGE_PAGES 0
+// Bound TEST_HEADLESS pods by vehicle acceleration and top speeds (0 for off, 1 for on)
+#define HEADLESS_ACCELERATION 0
+// Schedule TEST_HEADLESS auto pods by tile instead of by lane (0 for off, 1 for on)
+#define HEADLESS_TILES 0
+// Reserve the auto pods TEST_HEADLESS admits in a tick in their best ordering, not with tiles (0 for off, 1 for on)
+#define HEADLESS_ORDERED_ENTRIES 0
+// Most orderings tried per tick with HEADLESS_ORDERED_ENTRIES
+#define HEADLESS_ORDERING_LIMIT ORDERING_LIMIT
+// Let TEST_HEADLESS auto pods follow the pod ahead on their lane through the intersection (0 for off, 1 for on)
+#define HEADLESS_PLATOONS 0
+// Seeds run by TEST_PLATOONS, starting from the seed argument
+#define PLATOON_SEEDS 3
+// Limits of the vehicles TEST_KINEMATICS generates, below the speed limit so they bind
+#define KINEMATICS_MAX_SPEED 3
+#define KINEMATICS_TURN_SPEED 2
+#define KINEMATICS_ACCELERATION 0.5
+#define KINEMATICS_DECELERATION 1
+// Arrival rates TEST_ENGINES compares the engines at, in expected vehicles per 100 ticks
+#define ENGINE_RATES {5, 20, 60}
+
+/**
+ * ReservationWindow Struct
+ * Description:
+ *          Data structure for the intersection reservation a pod was given
+ * Contains:
+ *      Lane* lane - Pointer to the pod's lane
+ *      unsigned long int entry - Intersection entry time
+ *      unsigned long int exit - Intersection exit time
+ *      unsigned long int lastSeen - Latest tick the pod still held the window
+ **/
+struct ReservationWindow
+{
+    Lane* lane;
+    unsigned long int entry;
+    unsigned long int exit;
+    unsigned long int lastSeen;
+};
+
+// Orders reservation windows by entry time
+static bool enterFirst(const ReservationWindow& a, const ReservationWindow& b)
+{
+    return a.entry < b.entry;
+}
+
+/**
+ * WindowRecorder Class
+ * Description:
+ *          Autonomous controller that can copy out the reservation
+ *          windows of the pods in its world queue, by vehicle number.
+ *          A pod frees what is left of its window when it leaves the
+ *          world queue, so windows are cut short at the last tick the
+ *          pod was seen in it.
+ **/
+class WindowRecorder: public AutoTrafficController
+{
+public:
+    WindowRecorder(Intersection* theIntersection, unsigned int tickSpeed)
+        :AutoTrafficController(theIntersection, tickSpeed){}
+
+    void recordWindows(std::map<unsigned long int, ReservationWindow>& windows)
+    {
+        for (int i=0; i<worldQueue.size(); ++i)
+        {
+            ReservationWindow thisWindow;
+            thisWindow.lane = worldQueue[i]->getLane();
+            thisWindow.entry = worldQueue[i]->getEntry();
+            thisWindow.exit = worldQueue[i]->getExit();
+            thisWindow.lastSeen = globalTime;
+            std::pair<std::map<unsigned long int, ReservationWindow>::iterator, bool> added
+                = windows.insert(std::make_pair(worldQueue[i]->getPodNumber(), thisWindow));
+            added.first->second.lastSeen = globalTime;
+        }
+    }
+};
+
+/**
+ * PodMove Struct
+ * Description:
+ *          Data structure for the last move of a pod
+ * Contains:
+ *      int speed - Speed of the move, in fixed point
+ *      unsigned char phase - POD_ phase after the move
+ **/
+struct PodMove
+{
+    int speed;
+    unsigned char phase;
+};
+
+/**
+ * MoveChecker Class
+ * Description:
+ *          Stop controller that can check the last move of every pod it
+ *          controls against the move before it, by vehicle number, and
+ *          counts the moves that broke or reached a limit
+ **/
+class MoveChecker: public StopTrafficController
+{
+public:
+    MoveChecker(Intersection* theIntersection, unsigned int tickSpeed)
+        :StopTrafficController(theIntersection, tickSpeed), violations(0), limited(0){}
+
+    void checkMoves(std::map<unsigned long int, PodMove>& moves)
+    {
+        for (unsigned int i=0; i<controlledPods.size(); ++i)
+        {
+            PodMove thisMove;
+            thisMove.speed = controlledPods.currentSpeed[i];
+            thisMove.phase = controlledPods.phase[i];
+            std::map<unsigned long int, PodMove>::iterator it = moves.find(controlledPods[i]->getPodNumber());
+            if (it == moves.end())
+            {
+                // Every pod is admitted with room to brake for its place in the queue
+                LaneBounds& bounds = controlledPods.getBounds(i);
+                long long int stopFixed = PodStore::toFixed(bounds.beginIntersection) - PodStore::toFixed(controlledPods[i]->getPositionInQueue());
+                if (stopFixed - controlledPods.position[i] < controlledPods.stoppingDistance(i, thisMove.speed) - thisMove.speed)
+                {
+                    violations++;
+                }
+                moves.insert(std::make_pair(controlledPods[i]->getPodNumber(), thisMove));
+                continue;
+            }
+            // Speed changes within the limits, braking wins over the top speed
+            PodMove& lastMove = it->second;
+            int top = lastMove.phase == POD_INSIDE ? controlledPods.turnSpeed[i] : controlledPods.topSpeed[i];
+            int reach = lastMove.speed + controlledPods.acceleration[i];
+            int floor = lastMove.speed - controlledPods.deceleration[i];
+            if (thisMove.speed > reach || thisMove.speed < floor || (thisMove.speed > top && thisMove.speed != floor))
+            {
+                violations++;
+            }
+            // Every pod is stopped at the intersection before crossing it
+            if (lastMove.phase <= POD_WAITING && thisMove.phase > POD_WAITING
+                && (lastMove.phase != POD_WAITING || lastMove.speed != 0))
+            {
+                violations++;
+            }
+            if (thisMove.speed == reach || (thisMove.speed == floor && floor > 0))
+            {
+                limited++;
+            }
+            lastMove = thisMove;
+        }
+    }
+
+    unsigned long int violations;   // Pods admitted without room to stop, moves beyond a limit or into the intersection without stopping
+    unsigned long int limited;      // Moves that reached the acceleration or deceleration
+};
 
 // Traffic Controller Type
 #define AUTO    0
@@ -46,10 +230,14 @@ unsigned int controllerType;
 #define DEFAULT_TICK_MICROS 100000
 unsigned int tickSpeed;
 
-// Vehicle Spawn Chance per Iteration
+// Expected Vehicles per 100 Ticks
 #define DEFAULT_PROB 25
 unsigned int probability;
 
+// Random Seed
+#define DEFAULT_SEED 1
+unsigned int seed;
+
 // Global Variables
 Intersect4WSL* theIntersection;
 TrafficController* theTrafficController;
@@ -64,6 +252,7 @@ int main(int argc, char *argv[])
     controllerType = AUTO;
     tickSpeed = DEFAULT_TICK_MICROS;
     probability = DEFAULT_PROB;
+    seed = DEFAULT_SEED;
     // Check for second command line argument (--help or Controller Type)
     if (argc >= 2)
     {
@@ -135,20 +324,44 @@ int main(int argc, char *argv[])
         }
         probability = stoi(typeArg);
     }
+    // Check for fifth command line argument (Random Seed)
+    if (argc >= 5)
+    {
+        std::string typeArg = argv[4];
+        // Check for positive value
+        for (int i=0; i<typeArg.length(); ++i)
+        {
+            if (!isdigit(typeArg[i]))
+            {
+                std::cerr << "Invalid Command Line Input!\n"
+                          << "Found non-digit" << typeArg[i] << std::endl;
+                return 1;
+            }
+        }
+        seed = stoul(typeArg);
+    }
     // Check for too many args
-    if (argc > 4)
+    if (argc > 5)
     {
         std::cerr << "Too many arguments!\n"
-                    << "Received " << argc << ", support only offer up to 4.\n"
+                    << "Received " << argc << ", support only offer up to 5.\n"
                     << "Run --help for more info.\n"
                     << "Quitting...\n";
         return 1;
     }
+    // TEST_HEADLESS steps the controller on this thread, and the light
+    // cycle only runs on its own thread against the wall clock
+    if (TEST_HEADLESS && controllerType == LIGHT)
+    {
+        std::cerr << "TEST_HEADLESS does not support the Light controller!\n"
+                    << "Its light cycle runs in real time, use -A or -S.\n"
+                    << "Quitting...\n";
+        return 1;
+    }
 
     /**
      * Environment Setup
      **/
-    srand(time(NULL));
     double speedLimit = DEFAULT_SPEED_LIMIT;
     // For scaling the dimensions of the intersection on a screen
     double scale = controllerType == AUTO ? 40 : 36;
@@ -168,10 +381,13 @@ int main(int argc, char *argv[])
             theTrafficController = new AutoTrafficController(theIntersection, tickSpeed);
             break;
     }
-    // Start the Controller
-    theTrafficController->startController();
+    // Start the Controller (TEST_HEADLESS, TEST_PLATOONS, TEST_KINEMATICS and TEST_ENGINES step controllers on this thread instead)
+    if (!TEST_HEADLESS && !TEST_PLATOONS && !TEST_KINEMATICS && !TEST_ENGINES)
+    {
+        theTrafficController->startController();
+    }
     // Start traffic lights thread if a traffic light controller
-    if (controllerType == LIGHT)
+    if (controllerType == LIGHT && !TEST_HEADLESS && !TEST_PLATOONS && !TEST_KINEMATICS && !TEST_ENGINES)
     {
         LightTrafficController* control = dynamic_cast<LightTrafficController*>(theTrafficController);
         control->startLightCycle();
@@ -183,6 +399,7 @@ int main(int argc, char *argv[])
         std::cout << "Testing Intersection Setup\n";
         std::cout << theIntersection->getIntersectionID() <<  std::endl;
         std::string lane_id;
+        unsigned int maskMismatches = 0;
         for (int i=0; i<4; ++i)
         {
             for (int j=0; j<4; ++j)
@@ -204,10 +421,16 @@ int main(int argc, char *argv[])
                         {
                             std::cout << testLane <<  std::endl;
                         }
+                        // Bitmask must agree with the allowed lane IDs
+                        if (k != l && thisLane->isAllowedLane(testLane) != thisLane->isAllowedLane(theIntersection->getLane(k, l)))
+                        {
+                            maskMismatches++;
+                        }
                     }
                 }
             }
         }
+        std::cout << "Allowed lane mask mismatches: " << maskMismatches << std::endl;
     }
 
     // Test adding vehicles
@@ -217,16 +440,16 @@ int main(int argc, char *argv[])
         Vehicle* testVehicleA = new Vehicle("Alice", 10, 10, 1, theIntersection->getNode("0"), theIntersection->getNode("2"));
         vehicleCollection.push_back(testVehicleA);
         std::cout << "Vehicle pushed to queue\n";
-        theTrafficController->entryQueue.push(testVehicleA);
+        theTrafficController->enqueueVehicle(testVehicleA);
         std::this_thread::sleep_for(std::chrono::milliseconds(300));
         Vehicle* testVehicleB = new Vehicle("Bob", 10, 10, 1, theIntersection->getNode("1"), theIntersection->getNode("3"));
         vehicleCollection.push_back(testVehicleB);
         std::cout << "Vehicle pushed to queue\n";
-        theTrafficController->entryQueue.push(testVehicleB);
+        theTrafficController->enqueueVehicle(testVehicleB);
         Vehicle* testVehicleC = new Vehicle("Carol", 10, 10, 1, theIntersection->getNode("1"), theIntersection->getNode("2"));
         vehicleCollection.push_back(testVehicleC);
         std::cout << "Vehicle pushed to queue\n";
-        theTrafficController->entryQueue.push(testVehicleC);
+        theTrafficController->enqueueVehicle(testVehicleC);
         std::this_thread::sleep_for(std::chrono::seconds(30));
     }
 
@@ -237,15 +460,15 @@ int main(int argc, char *argv[])
         Vehicle* testVehicleA = new Vehicle("Alice", 10, 10, 1, theIntersection->getNode("0"), theIntersection->getNode("2"));
         vehicleCollection.push_back(testVehicleA);
         std::cout << "Vehicle pushed to queue\n";
-        theTrafficController->entryQueue.push(testVehicleA);
+        theTrafficController->enqueueVehicle(testVehicleA);
         Vehicle* testVehicleB = new Vehicle("Bob", 10, 10, 1, theIntersection->getNode("1"), theIntersection->getNode("3"));
         vehicleCollection.push_back(testVehicleB);
         std::cout << "Vehicle pushed to queue\n";
-        theTrafficController->entryQueue.push(testVehicleB);
+        theTrafficController->enqueueVehicle(testVehicleB);
         Vehicle* testVehicleC = new Vehicle("Carol", 10, 10, 1, theIntersection->getNode("1"), theIntersection->getNode("2"));
         vehicleCollection.push_back(testVehicleC);
         std::cout << "Vehicle pushed to queue\n";
-        theTrafficController->entryQueue.push(testVehicleC);
+        theTrafficController->enqueueVehicle(testVehicleC);
         std::this_thread::sleep_for(std::chrono::seconds(30));
     }
 
@@ -253,20 +476,252 @@ int main(int argc, char *argv[])
     if (TEST_TRAFFICJAM)
     {
         std::cout << "Testing Traffic Jam\n";
+        RngStream jamStream(seed, 0, STREAM_USER);
         for (int i=0; i<10; ++i)
         {
-            int dest = (rand() % 2) + 2;
-            int l = rand() % 2;
+            int dest = jamStream.below(2) + 2;
+            int l = jamStream.below(2);
             Vehicle* testVehicle = new Vehicle(std::to_string(i) + std::to_string(l), 10, 10, 1, theIntersection->getNode(std::to_string(l)), theIntersection->getNode(std::to_string(dest)));    
             std::cout << "Vehicle pushed to queue\n";
             vehicleCollection.push_back(testVehicle);
-            theTrafficController->entryQueue.push(testVehicle);
+            theTrafficController->enqueueVehicle(testVehicle);
         }
         std::this_thread::sleep_for(std::chrono::seconds(30));
     }
 
+    // Test Headless Engine
+    if (TEST_HEADLESS)
+    {
+        std::cout << "Testing Headless Engine\n";
+        Vehicle::getPool().setHugePages(HEADLESS_HUGE_PAGES);
+        Pod::getPool().setHugePages(HEADLESS_HUGE_PAGES);
+        if (!theTrafficController->setAccelerationLimited(HEADLESS_ACCELERATION))
+        {
+            std::cerr << "HEADLESS_ACCELERATION is only supported by the Stop controller!\n"
+                        << "Quitting...\n";
+            return 1;
+        }
+        if (controllerType == AUTO)
+        {
+            ((AutoTrafficController*)theTrafficController)->setTileReservations(HEADLESS_TILES);
+            if (!((AutoTrafficController*)theTrafficController)->setOrderedEntries(HEADLESS_ORDERED_ENTRIES))
+            {
+                std::cerr << "HEADLESS_ORDERED_ENTRIES cannot be combined with HEADLESS_TILES!\n"
+                            << "Quitting...\n";
+                return 1;
+            }
+            ((AutoTrafficController*)theTrafficController)->setOrderingLimit(HEADLESS_ORDERING_LIMIT);
+            if (!((AutoTrafficController*)theTrafficController)->setPlatoons(HEADLESS_PLATOONS))
+            {
+                std::cerr << "HEADLESS_PLATOONS cannot be combined with HEADLESS_TILES!\n"
+                            << "Quitting...\n";
+                return 1;
+            }
+        }
+        for (int r=0; r<HEADLESS_REPLICATIONS; ++r)
+        {
+            // Rewind the controller, keeping its allocations
+            if (r > 0)
+            {
+                theTrafficController->resetController();
+            }
+            DemandGenerator* testDemand = new DemandGenerator(theIntersection, seed, r);
+            testDemand->setArrivalRates(probability / 100.0 / theIntersection->getNumNodes());
+            theTrafficController->setDemand(testDemand);
+            if (HEADLESS_EVENTS)
+            {
+                theTrafficController->runEvents(HEADLESS_TICKS);
+            }
+            else
+            {
+                theTrafficController->run(HEADLESS_TICKS);
+            }
+
+            // Report results
+            std::cout << "Replication " << r << std::endl;
+            std::cout << "Vehicles Spawned: " << testDemand->getVehiclesGenerated() << std::endl;
+            std::cout << "Vehicles Exited: " << theTrafficController->getVehiclesProcessed() << std::endl;
+            std::cout << "Average Wait: " << theTrafficController->getAverageWait() << std::endl;
+            std::cout << "Simulated " << theTrafficController->getHeadlessTicks() << " ticks at "
+                      << theTrafficController->getTicksPerSecond() << " ticks per second\n";
+
+            // Controller keeps and frees the vehicles it spawned
+            theTrafficController->setDemand(NULL);
+            delete testDemand;
+        }
+
+        // Report pool statistics
+        PoolStats vehicleStats = Vehicle::getPool().getStats();
+        PoolStats podStats = Pod::getPool().getStats();
+        std::cout << "Vehicle Pool: " << vehicleStats.allocations << " allocations, " << vehicleStats.peak << " peak, "
+                  << vehicleStats.slabs << " slabs (" << vehicleStats.hugeSlabs << " huge), " << vehicleStats.bytesReserved << " bytes\n";
+        std::cout << "Pod Pool: " << podStats.allocations << " allocations, " << podStats.peak << " peak, "
+                  << podStats.slabs << " slabs (" << podStats.hugeSlabs << " huge), " << podStats.bytesReserved << " bytes\n";
+    }
+
+    // Test Platoon Reservations
+    if (TEST_PLATOONS)
+    {
+        std::cout << "Testing Platoon Reservations\n";
+        unsigned long int numWindows = 0;
+        unsigned long int numOverlaps = 0;
+        for (int r=0; r<PLATOON_SEEDS; ++r)
+        {
+            WindowRecorder platoonController(theIntersection, tickSpeed);
+            platoonController.setPlatoons(true);
+            DemandGenerator platoonDemand(theIntersection, seed + r, 0);
+            platoonDemand.setArrivalRates(probability / 100.0 / theIntersection->getNumNodes());
+            platoonController.setDemand(&platoonDemand);
+
+            // Record the window of every pod while it is in the world queue
+            std::map<unsigned long int, ReservationWindow> seen;
+            for (int t=0; t<HEADLESS_TICKS; ++t)
+            {
+                platoonController.step();
+                platoonController.recordWindows(seen);
+            }
+            platoonController.setDemand(NULL);
+
+            // Windows of conflicting lanes must never overlap
+            std::vector<ReservationWindow> windows;
+            for (std::map<unsigned long int, ReservationWindow>::iterator it=seen.begin(); it!=seen.end(); ++it)
+            {
+                ReservationWindow thisWindow = it->second;
+                thisWindow.exit = thisWindow.exit < thisWindow.lastSeen ? thisWindow.exit : thisWindow.lastSeen;
+                windows.push_back(thisWindow);
+            }
+            std::sort(windows.begin(), windows.end(), enterFirst);
+            for (int i=0; i<windows.size(); ++i)
+            {
+                for (int j=i+1; j<windows.size() && windows[j].entry < windows[i].exit; ++j)
+                {
+                    if (windows[i].lane != windows[j].lane && !windows[i].lane->isAllowedLane(windows[j].lane)
+                        && windows[i].exit > windows[i].entry && windows[j].exit > windows[j].entry)
+                    {
+                        numOverlaps++;
+                    }
+                }
+            }
+            numWindows += windows.size();
+        }
+        std::cout << "Reservation Windows: " << numWindows << std::endl;
+        std::cout << "Overlapping Windows: " << numOverlaps << std::endl;
+        if (numOverlaps > 0)
+        {
+            std::cerr << "Platoon reservations overlap!\n";
+            return 1;
+        }
+    }
+
+    // Test Kinematics
+    if (TEST_KINEMATICS)
+    {
+        std::cout << "Testing Kinematics\n";
+        MoveChecker kinematicsController(theIntersection, tickSpeed);
+        kinematicsController.setAccelerationLimited(true);
+        DemandGenerator kinematicsDemand(theIntersection, seed, 0);
+        kinematicsDemand.setArrivalRates(probability / 100.0 / theIntersection->getNumNodes());
+        kinematicsDemand.setVehicleLimits(KINEMATICS_MAX_SPEED, KINEMATICS_TURN_SPEED, KINEMATICS_ACCELERATION, KINEMATICS_DECELERATION);
+        kinematicsController.setDemand(&kinematicsDemand);
+
+        // Check every move of every pod against its limits
+        std::map<unsigned long int, PodMove> moves;
+        for (int t=0; t<HEADLESS_TICKS; ++t)
+        {
+            kinematicsController.step();
+            kinematicsController.checkMoves(moves);
+        }
+        kinematicsController.setDemand(NULL);
+        std::cout << "Vehicles Exited: " << kinematicsController.getVehiclesProcessed() << std::endl;
+        std::cout << "Average Wait: " << kinematicsController.getAverageWait() << std::endl;
+        std::cout << "Limited Moves: " << kinematicsController.limited << std::endl;
+        std::cout << "Violations: " << kinematicsController.violations << std::endl;
+        if (kinematicsController.violations > 0 || kinematicsController.limited == 0)
+        {
+            std::cerr << "Vehicle limits not held!\n";
+            return 1;
+        }
+
+        // Auto reserves and Light stops from the speed limits, so both refuse the limits
+        AutoTrafficController autoKinematics(theIntersection, tickSpeed);
+        LightTrafficController lightKinematics(theIntersection, tickSpeed);
+        bool autoLimited = autoKinematics.setAccelerationLimited(true);
+        bool lightLimited = lightKinematics.setAccelerationLimited(true);
+        std::cout << "Auto Takes Limits: " << autoLimited << std::endl;
+        std::cout << "Light Takes Limits: " << lightLimited << std::endl;
+        if (autoLimited || lightLimited)
+        {
+            std::cerr << "Limits taken by a controller that does not plan for them!\n";
+            return 1;
+        }
+    }
+
+    // Test Tick Stepping Against Discrete Events
+    if (TEST_ENGINES)
+    {
+        std::cout << "Testing Tick Stepping Against Discrete Events\n";
+        unsigned int rates[] = ENGINE_RATES;
+        unsigned int numMismatches = 0;
+        // Stop with and without acceleration limits, Auto refuses them
+        for (int c=0; c<3; ++c)
+        {
+            bool limited = c == 1;
+            for (int i=0; i<sizeof(rates)/sizeof(rates[0]); ++i)
+            {
+                unsigned long int processed[2];
+                double averageWait[2];
+                for (int events=0; events<2; ++events)
+                {
+                    TrafficController* engineController;
+                    if (c < 2)
+                    {
+                        engineController = new StopTrafficController(theIntersection, tickSpeed);
+                    }
+                    else
+                    {
+                        engineController = new AutoTrafficController(theIntersection, tickSpeed);
+                    }
+                    engineController->setAccelerationLimited(limited);
+                    DemandGenerator engineDemand(theIntersection, seed, 0);
+                    engineDemand.setArrivalRates(rates[i] / 100.0 / theIntersection->getNumNodes());
+                    if (limited)
+                    {
+                        engineDemand.setVehicleLimits(KINEMATICS_MAX_SPEED, KINEMATICS_TURN_SPEED, KINEMATICS_ACCELERATION, KINEMATICS_DECELERATION);
+                    }
+                    engineController->setDemand(&engineDemand);
+                    if (events)
+                    {
+                        engineController->runEvents(HEADLESS_TICKS);
+                    }
+                    else
+                    {
+                        engineController->run(HEADLESS_TICKS);
+                    }
+                    processed[events] = engineController->getVehiclesProcessed();
+                    averageWait[events] = engineController->getAverageWait();
+                    engineController->setDemand(NULL);
+                    delete engineController;
+                }
+                std::cout << (c < 2 ? "Stop" : "Auto") << (limited ? " Limited" : "") << " at " << rates[i] << ": "
+                          << processed[0] << " exited, " << averageWait[0] << " wait stepped, "
+                          << processed[1] << " exited, " << averageWait[1] << " wait with events\n";
+                if (processed[0] != processed[1] || averageWait[0] != averageWait[1])
+                {
+                    numMismatches++;
+                }
+            }
+        }
+        std::cout << "Engine Mismatches: " << numMismatches << std::endl;
+        if (numMismatches > 0)
+        {
+            std::cerr << "Discrete events differ from tick stepping!\n";
+            return 1;
+        }
+    }
+
     // Cleanup
     theTrafficController->stopController();
+    theTrafficController->joinController();
     delete theTrafficController;
     delete theIntersection;
     for (int i=0; i<vehicleCollection.size(); ++i)